@@ -0,0 +1,376 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <jni.h> // JNI header provided by JDK
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include "openvino/openvino.hpp"
+
+#include "openvino_java.hpp"
+#include "jni_common.hpp"
+
+using namespace ov;
+
+namespace {
+// The classes are looked up on a Java thread: FindClass would not see the application classes on a native thread
+struct QueueMethods
+{
+    jmethodID on_complete;
+    jclass infer_request_class;
+    jmethodID infer_request_init;
+    jclass exception_class;
+    jmethodID exception_init;
+};
+
+const QueueMethods &get_queue_methods(JNIEnv *env)
+{
+    static const QueueMethods methods = [env]() {
+        QueueMethods result;
+        jclass callback_class = env->FindClass("org/intel/openvino/AsyncInferQueueCallback");
+        result.on_complete = env->GetMethodID(callback_class, "onComplete",
+            "(Lorg/intel/openvino/InferRequest;Ljava/lang/Object;Ljava/lang/Exception;)V");
+        jclass infer_request_class = env->FindClass("org/intel/openvino/InferRequest");
+        result.infer_request_class = (jclass)env->NewGlobalRef(infer_request_class);
+        result.infer_request_init = env->GetMethodID(infer_request_class, "<init>", "(J)V");
+        jclass exception_class = env->FindClass("java/lang/Exception");
+        result.exception_class = (jclass)env->NewGlobalRef(exception_class);
+        result.exception_init = env->GetMethodID(exception_class, "<init>", "(Ljava/lang/String;)V");
+        return result;
+    }();
+    return methods;
+}
+
+// Lock-free (Treiber) stack of the idle request IDs. The head is tagged with a counter incremented by every update, so
+// that a pop racing with a pop and a push of the same ID (the ABA problem) fails its compare-and-swap.
+class IdleIdStack
+{
+public:
+    explicit IdleIdStack(size_t capacity) : m_next(capacity) {}
+
+    void push(uint32_t id)
+    {
+        uint64_t head = m_head.load();
+        do
+        {
+            m_next[id].store(get_id(head));
+        } while (!m_head.compare_exchange_weak(head, make_head(head, id)));
+        m_size++;
+    }
+
+    bool pop(uint32_t &id)
+    {
+        uint64_t head = m_head.load();
+        do
+        {
+            if (get_id(head) == EMPTY)
+                return false;
+            id = get_id(head);
+        } while (!m_head.compare_exchange_weak(head, make_head(head, m_next[id].load())));
+        m_size--;
+        return true;
+    }
+
+    bool peek(uint32_t &id) const
+    {
+        id = get_id(m_head.load());
+        return id != EMPTY;
+    }
+
+    size_t size() const
+    {
+        return m_size.load();
+    }
+
+private:
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+
+    static uint32_t get_id(uint64_t head)
+    {
+        return static_cast<uint32_t>(head);
+    }
+
+    static uint64_t make_head(uint64_t previous_head, uint32_t id)
+    {
+        return ((previous_head >> 32) + 1) << 32 | id;
+    }
+
+    std::atomic<uint64_t> m_head{EMPTY};
+    std::vector<std::atomic<uint32_t>> m_next;
+    // may lag behind the stack, it is only used to tell when all the requests are idle
+    std::atomic<size_t> m_size{0};
+};
+
+// Keeps the requests of a compiled model busy: each inference is started on an idle request, and the request becomes
+// idle again once its completion has been delivered to the Java callback. Taking and returning the idle requests is
+// lock-free; the mutex is only locked by the callers waiting for a request to become idle.
+class AsyncInferQueue
+{
+public:
+    AsyncInferQueue(JNIEnv *env, const CompiledModel &compiled_model, size_t jobs)
+        : m_methods(get_queue_methods(env)),
+          m_requests(jobs ? jobs : compiled_model.get_property(ov::optimal_number_of_infer_requests)),
+          m_idle_ids(m_requests.size())
+    {
+        env->GetJavaVM(&m_vm);
+        for (size_t id = 0; id < m_requests.size(); id++)
+        {
+            InferRequest &infer_request = m_requests[id].infer_request;
+            infer_request = compiled_model.create_infer_request();
+            infer_request.set_callback([this, id](std::exception_ptr exception_ptr) {
+                on_complete(id, exception_ptr);
+            });
+            // the Java object owns a copy of the request handle, it is shared by get_request() and the callbacks
+            jobject java_request = env->NewObject(m_methods.infer_request_class, m_methods.infer_request_init,
+                                                  (jlong) new InferRequest(infer_request));
+            m_requests[id].java_request = make_global_ref(env, java_request);
+            env->DeleteLocalRef(java_request);
+            m_idle_ids.push(static_cast<uint32_t>(id));
+        }
+    }
+
+    ~AsyncInferQueue()
+    {
+        // the callbacks of the running requests refer to the queue, and the Java requests returned by get_request()
+        // share the callbacks, so they must not call into the queue once it is destroyed
+        wait_all();
+        for (Request &request : m_requests)
+            request.infer_request.set_callback([](std::exception_ptr) {});
+    }
+
+    size_t get_size() const
+    {
+        return m_requests.size();
+    }
+
+    bool is_ready() const
+    {
+        return m_idle_ids.size() > 0;
+    }
+
+    size_t get_idle_request_id()
+    {
+        uint32_t id;
+        wait_until([this, &id] { return m_idle_ids.peek(id); });
+        return id;
+    }
+
+    jobject get_request(JNIEnv *env, size_t id) const
+    {
+        return env->NewLocalRef(m_requests.at(id).java_request.get());
+    }
+
+    void set_callback(JNIEnv *env, jobject callback)
+    {
+        if (m_idle_ids.size() != m_requests.size())
+            throw std::runtime_error("The callback of the queue cannot be replaced while inferences are running!");
+        m_callback = callback ? make_global_ref(env, callback) : nullptr;
+    }
+
+    void start_async(JNIEnv *env, const Tensor &input, jobject userdata)
+    {
+        uint32_t id;
+        if (!m_idle_ids.pop(id))
+            wait_until([this, &id] { return m_idle_ids.pop(id); });
+        // the request is returned to the stack at the end of its callback, which may still be running
+        wait_for_callback(id);
+
+        Request &request = m_requests[id];
+        try
+        {
+            request.infer_request.set_input_tensor(input);
+            request.userdata = userdata ? env->NewGlobalRef(userdata) : nullptr;
+            request.queued = true;
+            request.infer_request.start_async();
+        }
+        catch (...)
+        {
+            request.queued = false;
+            if (request.userdata)
+                env->DeleteGlobalRef(request.userdata);
+            request.userdata = nullptr;
+            release(id);
+            throw;
+        }
+    }
+
+    void wait_all()
+    {
+        wait_until([this] { return m_idle_ids.size() == m_requests.size(); });
+        for (size_t id = 0; id < m_requests.size(); id++)
+            wait_for_callback(id);
+    }
+
+private:
+    struct Request
+    {
+        InferRequest infer_request;
+        std::shared_ptr<_jobject> java_request;
+        jobject userdata = nullptr;
+        // set only for the inferences started by the queue, as the Java request may be started directly as well
+        std::atomic<bool> queued{false};
+    };
+
+    std::shared_ptr<_jobject> make_global_ref(JNIEnv *env, jobject object) const
+    {
+        JavaVM *vm = m_vm;
+        return std::shared_ptr<_jobject>(env->NewGlobalRef(object), [vm](jobject ref) {
+            get_thread_env(vm)->DeleteGlobalRef(ref);
+        });
+    }
+
+    void on_complete(size_t id, std::exception_ptr exception_ptr)
+    {
+        Request &request = m_requests[id];
+        // the ID of a request started outside of the queue has not been taken from the stack, so it must not be
+        // returned there: pushing an ID which is already on the stack would link it to itself
+        if (!request.queued.load())
+            return;
+        JNIEnv *env = get_thread_env(m_vm);
+        // set_callback() cannot run concurrently, since this request is not idle yet
+        if (m_callback)
+        {
+            jobject exception = nullptr;
+            if (exception_ptr)
+            {
+                jstring message = env->NewStringUTF(get_exception_message(exception_ptr).c_str());
+                exception = env->NewObject(m_methods.exception_class, m_methods.exception_init, message);
+                env->DeleteLocalRef(message);
+            }
+            env->CallVoidMethod(m_callback.get(), m_methods.on_complete, request.java_request.get(), request.userdata,
+                                exception);
+            if (env->ExceptionCheck())
+            {
+                // there is no Java caller to propagate the exception to
+                env->ExceptionDescribe();
+                env->ExceptionClear();
+            }
+            if (exception)
+                env->DeleteLocalRef(exception);
+        }
+        if (request.userdata)
+            env->DeleteGlobalRef(request.userdata);
+        request.userdata = nullptr;
+        request.queued = false;
+        release(id);
+    }
+
+    void release(size_t id)
+    {
+        m_idle_ids.push(static_cast<uint32_t>(id));
+        // a waiter registers itself before checking the stack, so it either sees this push or gets notified
+        if (m_waiters.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_idle.notify_all();
+        }
+    }
+
+    template <typename Predicate>
+    void wait_until(Predicate predicate)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_waiters++;
+        m_idle.wait(lock, predicate);
+        m_waiters--;
+    }
+
+    void wait_for_callback(size_t id)
+    {
+        try
+        {
+            m_requests[id].infer_request.wait();
+        }
+        catch (...)
+        {
+            // the failure of the previous inference has already been passed to the callback
+        }
+    }
+
+    const QueueMethods &m_methods;
+    JavaVM *m_vm = nullptr;
+    std::vector<Request> m_requests;
+    IdleIdStack m_idle_ids;
+    std::shared_ptr<_jobject> m_callback;
+    std::atomic<int> m_waiters{0};
+    std::mutex m_mutex;
+    std::condition_variable m_idle;
+};
+} // namespace
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_AsyncInferQueue_Create(JNIEnv *env, jobject obj, jlong modelAddr, jint jobs)
+{
+    JNI_METHOD("Create",
+        CompiledModel *compiled_model = (CompiledModel *)modelAddr;
+        AsyncInferQueue *queue = new AsyncInferQueue(env, *compiled_model, jobs > 0 ? jobs : 0);
+        return (jlong)queue;
+    )
+    return 0;
+}
+
+JNIEXPORT jint JNICALL Java_org_intel_openvino_AsyncInferQueue_GetSize(JNIEnv *env, jobject obj, jlong addr)
+{
+    JNI_METHOD("GetSize",
+        AsyncInferQueue *queue = (AsyncInferQueue *)addr;
+        return (jint)queue->get_size();
+    )
+    return 0;
+}
+
+JNIEXPORT jboolean JNICALL Java_org_intel_openvino_AsyncInferQueue_IsReady(JNIEnv *env, jobject obj, jlong addr)
+{
+    JNI_METHOD("IsReady",
+        AsyncInferQueue *queue = (AsyncInferQueue *)addr;
+        return (jboolean)queue->is_ready();
+    )
+    return false;
+}
+
+JNIEXPORT jint JNICALL Java_org_intel_openvino_AsyncInferQueue_GetIdleRequestId(JNIEnv *env, jobject obj, jlong addr)
+{
+    JNI_METHOD("GetIdleRequestId",
+        AsyncInferQueue *queue = (AsyncInferQueue *)addr;
+        return (jint)queue->get_idle_request_id();
+    )
+    return 0;
+}
+
+JNIEXPORT jobject JNICALL Java_org_intel_openvino_AsyncInferQueue_GetRequest(JNIEnv *env, jobject obj, jlong addr, jint id)
+{
+    JNI_METHOD("GetRequest",
+        AsyncInferQueue *queue = (AsyncInferQueue *)addr;
+        return queue->get_request(env, id);
+    )
+    return 0;
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_AsyncInferQueue_SetCallback(JNIEnv *env, jobject obj, jlong addr, jobject callback)
+{
+    JNI_METHOD("SetCallback",
+        AsyncInferQueue *queue = (AsyncInferQueue *)addr;
+        queue->set_callback(env, callback);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_AsyncInferQueue_StartAsync(JNIEnv *env, jobject obj, jlong addr, jlong tensorAddr, jobject userdata)
+{
+    JNI_METHOD("StartAsync",
+        AsyncInferQueue *queue = (AsyncInferQueue *)addr;
+        Tensor *input_tensor = (Tensor *)tensorAddr;
+        queue->start_async(env, *input_tensor, userdata);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_AsyncInferQueue_WaitAll(JNIEnv *env, jobject obj, jlong addr)
+{
+    JNI_METHOD("WaitAll",
+        AsyncInferQueue *queue = (AsyncInferQueue *)addr;
+        queue->wait_all();
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_AsyncInferQueue_delete(JNIEnv *, jobject, jlong addr)
+{
+    AsyncInferQueue *queue = (AsyncInferQueue *)addr;
+    delete queue;
+}
@@ -9,6 +9,61 @@
 
 using namespace ov;
 
+namespace {
+// The method IDs stay valid for as long as the classes are loaded, so they are only looked up once
+struct CallbackMethods
+{
+    jmethodID on_complete;
+    jclass exception_class;
+    jmethodID exception_init;
+};
+
+const CallbackMethods &get_callback_methods(JNIEnv *env)
+{
+    static const CallbackMethods methods = [env]() {
+        CallbackMethods result;
+        jclass callback_class = env->FindClass("org/intel/openvino/InferRequestCallback");
+        result.on_complete = env->GetMethodID(callback_class, "onComplete", "(Ljava/lang/Exception;)V");
+        jclass exception_class = env->FindClass("java/lang/Exception");
+        result.exception_class = (jclass)env->NewGlobalRef(exception_class);
+        result.exception_init = env->GetMethodID(exception_class, "<init>", "(Ljava/lang/String;)V");
+        return result;
+    }();
+    return methods;
+}
+
+// Wraps a Java InferRequestCallback into an ov::InferRequest callback, which is invoked on an OpenVINO thread
+std::function<void(std::exception_ptr)> make_callback(JNIEnv *env, jobject callback)
+{
+    const CallbackMethods &methods = get_callback_methods(env);
+    JavaVM *vm = nullptr;
+    env->GetJavaVM(&vm);
+    std::shared_ptr<_jobject> callback_ref(env->NewGlobalRef(callback), [vm](jobject ref) {
+        get_thread_env(vm)->DeleteGlobalRef(ref);
+    });
+
+    return [vm, callback_ref, &methods](std::exception_ptr exception_ptr) {
+        JNIEnv *thread_env = get_thread_env(vm);
+        jobject exception = nullptr;
+        if (exception_ptr) {
+            jstring message = thread_env->NewStringUTF(get_exception_message(exception_ptr).c_str());
+            exception = thread_env->NewObject(methods.exception_class, methods.exception_init, message);
+            thread_env->DeleteLocalRef(message);
+        }
+
+        thread_env->CallVoidMethod(callback_ref.get(), methods.on_complete, exception);
+        if (thread_env->ExceptionCheck()) {
+            // there is no Java caller to propagate the exception to
+            thread_env->ExceptionDescribe();
+            thread_env->ExceptionClear();
+        }
+        // the local references of an attached native thread are never released automatically
+        if (exception)
+            thread_env->DeleteLocalRef(exception);
+    };
+}
+} // namespace
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Infer(JNIEnv *env, jobject obj, jlong addr)
 {
     JNI_METHOD("Infer",
@@ -32,6 +87,17 @@ JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Wait(JNIEnv *env, jo
     )
 }
 
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetCallback(JNIEnv *env, jobject obj, jlong addr, jobject callback)
+{
+    JNI_METHOD("SetCallback",
+        InferRequest *infer_request = (InferRequest *)addr;
+        if (callback)
+            infer_request->set_callback(make_callback(env, callback));
+        else
+            infer_request->set_callback([](std::exception_ptr) {});
+    )
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetInputTensor(JNIEnv *env, jobject, jlong addr, jlong tensorAddr)
 {
     JNI_METHOD("SetInputTensor",
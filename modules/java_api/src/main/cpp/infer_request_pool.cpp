@@ -0,0 +1,250 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <jni.h> // JNI header provided by JDK
+#include <condition_variable>
+#include <mutex>
+#include "openvino/openvino.hpp"
+
+#include "openvino_java.hpp"
+#include "jni_common.hpp"
+
+using namespace ov;
+
+namespace {
+// The classes are looked up on a Java thread: FindClass would not see the application classes on a native thread
+struct FutureMethods
+{
+    jmethodID complete;
+    jmethodID complete_exceptionally;
+    jclass tensor_class;
+    jmethodID tensor_init;
+    jclass exception_class;
+    jmethodID exception_init;
+};
+
+const FutureMethods &get_future_methods(JNIEnv *env)
+{
+    static const FutureMethods methods = [env]() {
+        FutureMethods result;
+        jclass future_class = env->FindClass("java/util/concurrent/CompletableFuture");
+        result.complete = env->GetMethodID(future_class, "complete", "(Ljava/lang/Object;)Z");
+        result.complete_exceptionally = env->GetMethodID(future_class, "completeExceptionally",
+                                                         "(Ljava/lang/Throwable;)Z");
+        jclass tensor_class = env->FindClass("org/intel/openvino/Tensor");
+        result.tensor_class = (jclass)env->NewGlobalRef(tensor_class);
+        result.tensor_init = env->GetMethodID(tensor_class, "<init>", "(J)V");
+        jclass exception_class = env->FindClass("java/lang/Exception");
+        result.exception_class = (jclass)env->NewGlobalRef(exception_class);
+        result.exception_init = env->GetMethodID(exception_class, "<init>", "(Ljava/lang/String;)V");
+        return result;
+    }();
+    return methods;
+}
+
+// The output tensor of a request is overwritten by its next inference, so the callers get a copy of it
+Tensor *copy_output_tensor(InferRequest &infer_request)
+{
+    const Tensor output = infer_request.get_output_tensor();
+    Tensor *result = new Tensor(output.get_element_type(), output.get_shape());
+    output.copy_to(*result);
+    return result;
+}
+
+// Hands out the requests of a compiled model to concurrent callers, so that each inference runs on a request of its
+// own. The callers block (in native code) only while all the requests are busy.
+class InferRequestPool
+{
+public:
+    InferRequestPool(const CompiledModel &compiled_model, size_t size)
+    {
+        if (size == 0)
+            size = compiled_model.get_property(ov::optimal_number_of_infer_requests);
+        for (size_t id = 0; id < size; id++)
+        {
+            m_requests.push_back(compiled_model.create_infer_request());
+            m_idle_ids.push_back(id);
+        }
+    }
+
+    ~InferRequestPool()
+    {
+        // the callbacks of the running requests refer to the pool
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idle.wait(lock, [this] { return m_idle_ids.size() == m_requests.size(); });
+        for (size_t id = 0; id < m_requests.size(); id++)
+            wait_for_callback(id);
+    }
+
+    size_t get_size() const
+    {
+        return m_requests.size();
+    }
+
+    Tensor *infer(const Tensor &input)
+    {
+        const size_t id = acquire();
+        Tensor *output = nullptr;
+        try
+        {
+            m_requests[id].set_input_tensor(input);
+            m_requests[id].infer();
+            output = copy_output_tensor(m_requests[id]);
+        }
+        catch (...)
+        {
+            release(id);
+            throw;
+        }
+        release(id);
+        return output;
+    }
+
+    void infer_async(JNIEnv *env, const Tensor &input, jobject future)
+    {
+        const FutureMethods &methods = get_future_methods(env);
+        JavaVM *vm = nullptr;
+        env->GetJavaVM(&vm);
+        std::shared_ptr<_jobject> future_ref(env->NewGlobalRef(future), [vm](jobject ref) {
+            get_thread_env(vm)->DeleteGlobalRef(ref);
+        });
+
+        const size_t id = acquire();
+        try
+        {
+            InferRequest &infer_request = m_requests[id];
+            infer_request.set_input_tensor(input);
+            infer_request.set_callback([this, id, vm, future_ref, &methods](std::exception_ptr exception_ptr) mutable {
+                Tensor *output = nullptr;
+                if (!exception_ptr)
+                {
+                    try
+                    {
+                        output = copy_output_tensor(m_requests[id]);
+                    }
+                    catch (...)
+                    {
+                        exception_ptr = std::current_exception();
+                    }
+                }
+                // the request is handed out again only after this callback returns, see acquire()
+                release(id);
+
+                JNIEnv *thread_env = get_thread_env(vm);
+                jobject result = nullptr;
+                if (output)
+                {
+                    result = thread_env->NewObject(methods.tensor_class, methods.tensor_init, (jlong)output);
+                    thread_env->CallBooleanMethod(future_ref.get(), methods.complete, result);
+                }
+                else
+                {
+                    jstring message = thread_env->NewStringUTF(get_exception_message(exception_ptr).c_str());
+                    result = thread_env->NewObject(methods.exception_class, methods.exception_init, message);
+                    thread_env->DeleteLocalRef(message);
+                    thread_env->CallBooleanMethod(future_ref.get(), methods.complete_exceptionally, result);
+                }
+                if (thread_env->ExceptionCheck())
+                {
+                    // thrown by a dependent action of the future, there is no Java caller to propagate it to
+                    thread_env->ExceptionDescribe();
+                    thread_env->ExceptionClear();
+                }
+                thread_env->DeleteLocalRef(result);
+                // the callback itself stays set until the request is started again
+                future_ref.reset();
+            });
+            infer_request.start_async();
+        }
+        catch (...)
+        {
+            release(id);
+            throw;
+        }
+    }
+
+private:
+    size_t acquire()
+    {
+        size_t id;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_idle.wait(lock, [this] { return !m_idle_ids.empty(); });
+            id = m_idle_ids.back();
+            m_idle_ids.pop_back();
+        }
+        // the request is released from its completion callback, which may still be running
+        wait_for_callback(id);
+        return id;
+    }
+
+    void release(size_t id)
+    {
+        // notified under the lock: the destructor may destroy the condition variable as soon as it is unlocked
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_idle_ids.push_back(id);
+        m_idle.notify_all();
+    }
+
+    void wait_for_callback(size_t id)
+    {
+        try
+        {
+            m_requests[id].wait();
+        }
+        catch (...)
+        {
+            // the failure of the previous inference has already been reported to its caller
+        }
+    }
+
+    std::vector<InferRequest> m_requests;
+    std::vector<size_t> m_idle_ids;
+    std::mutex m_mutex;
+    std::condition_variable m_idle;
+};
+} // namespace
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequestPool_Create(JNIEnv *env, jobject obj, jlong modelAddr, jint size)
+{
+    JNI_METHOD("Create",
+        CompiledModel *compiled_model = (CompiledModel *)modelAddr;
+        InferRequestPool *pool = new InferRequestPool(*compiled_model, size > 0 ? size : 0);
+        return (jlong)pool;
+    )
+    return 0;
+}
+
+JNIEXPORT jint JNICALL Java_org_intel_openvino_InferRequestPool_GetSize(JNIEnv *env, jobject obj, jlong addr)
+{
+    JNI_METHOD("GetSize",
+        InferRequestPool *pool = (InferRequestPool *)addr;
+        return (jint)pool->get_size();
+    )
+    return 0;
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequestPool_Infer(JNIEnv *env, jobject obj, jlong addr, jlong tensorAddr)
+{
+    JNI_METHOD("Infer",
+        InferRequestPool *pool = (InferRequestPool *)addr;
+        Tensor *input_tensor = (Tensor *)tensorAddr;
+        return (jlong)pool->infer(*input_tensor);
+    )
+    return 0;
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequestPool_InferAsync(JNIEnv *env, jobject obj, jlong addr, jlong tensorAddr, jobject future)
+{
+    JNI_METHOD("InferAsync",
+        InferRequestPool *pool = (InferRequestPool *)addr;
+        Tensor *input_tensor = (Tensor *)tensorAddr;
+        pool->infer_async(env, *input_tensor, future);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequestPool_delete(JNIEnv *, jobject, jlong addr)
+{
+    InferRequestPool *pool = (InferRequestPool *)addr;
+    delete pool;
+}
@@ -232,6 +232,49 @@ static jobject vectorToJavaList(JNIEnv *env, std::vector<std::string> items)
     return nullptr;
 }
 
+// Returns the JNIEnv of the calling thread. Native threads (e.g. the ones OpenVINO runs the inference and the callbacks
+// on) are attached to the JVM as daemon threads on the first call and detached when they exit.
+static JNIEnv *get_thread_env(JavaVM *vm)
+{
+    JNIEnv *env = nullptr;
+    if (vm->GetEnv(reinterpret_cast<void **>(&env), JNI_VERSION_1_6) == JNI_OK)
+        return env;
+
+    struct ThreadDetacher
+    {
+        JavaVM *vm = nullptr;
+        ~ThreadDetacher()
+        {
+            if (vm)
+                vm->DetachCurrentThread();
+        }
+    };
+    static thread_local ThreadDetacher detacher;
+
+    if (vm->AttachCurrentThreadAsDaemon(reinterpret_cast<void **>(&env), nullptr) != JNI_OK)
+        throw std::runtime_error("Failed to attach the native thread to the JVM!");
+    detacher.vm = vm;
+    return env;
+}
+
+// Returns the message of the exception stored in the exception pointer, e.g. the one an asynchronous inference failed
+// with, so that it can be reported to Java
+static std::string get_exception_message(std::exception_ptr exception_ptr)
+{
+    try
+    {
+        std::rethrow_exception(exception_ptr);
+    }
+    catch (const std::exception &e)
+    {
+        return e.what();
+    }
+    catch (...)
+    {
+    }
+    return "unknown exception";
+}
+
 static const ov::element::Type_t& get_ov_type(int type)
 {
     static const std::vector<ov::element::Type_t> java_type_to_ov_type
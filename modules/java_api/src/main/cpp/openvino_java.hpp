@@ -50,6 +50,7 @@ extern "C"
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Infer(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_StartAsync(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Wait(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetCallback(JNIEnv *, jobject, jlong, jobject);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetInputTensor(JNIEnv *, jobject, jlong, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetOutputTensor(JNIEnv *, jobject, jlong, jlong);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetOutputTensor(JNIEnv *, jobject, jlong);
@@ -57,8 +58,27 @@ extern "C"
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetTensor(JNIEnv *, jobject, jlong, jstring, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_delete(JNIEnv *, jobject, jlong);
 
+    // InferRequestPool
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequestPool_Create(JNIEnv *, jobject, jlong, jint);
+    JNIEXPORT jint JNICALL Java_org_intel_openvino_InferRequestPool_GetSize(JNIEnv *, jobject, jlong);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequestPool_Infer(JNIEnv *, jobject, jlong, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequestPool_InferAsync(JNIEnv *, jobject, jlong, jlong, jobject);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequestPool_delete(JNIEnv *, jobject, jlong);
+
+    // AsyncInferQueue
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_AsyncInferQueue_Create(JNIEnv *, jobject, jlong, jint);
+    JNIEXPORT jint JNICALL Java_org_intel_openvino_AsyncInferQueue_GetSize(JNIEnv *, jobject, jlong);
+    JNIEXPORT jboolean JNICALL Java_org_intel_openvino_AsyncInferQueue_IsReady(JNIEnv *, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_org_intel_openvino_AsyncInferQueue_GetIdleRequestId(JNIEnv *, jobject, jlong);
+    JNIEXPORT jobject JNICALL Java_org_intel_openvino_AsyncInferQueue_GetRequest(JNIEnv *, jobject, jlong, jint);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_AsyncInferQueue_SetCallback(JNIEnv *, jobject, jlong, jobject);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_AsyncInferQueue_StartAsync(JNIEnv *, jobject, jlong, jlong, jobject);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_AsyncInferQueue_WaitAll(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_AsyncInferQueue_delete(JNIEnv *, jobject, jlong);
+
     // ov::Tensor
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorCArray(JNIEnv *, jobject, jint, jintArray, jlong);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorDirectBuffer(JNIEnv *, jobject, jint, jintArray, jobject);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorFloat(JNIEnv *, jobject, jintArray, jfloatArray);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorInt(JNIEnv *, jobject, jintArray, jintArray);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorLong(JNIEnv *, jobject, jintArray, jlongArray);
@@ -66,6 +86,14 @@ extern "C"
     JNIEXPORT jintArray JNICALL Java_org_intel_openvino_Tensor_GetShape(JNIEnv *, jobject, jlong);
     JNIEXPORT jfloatArray JNICALL Java_org_intel_openvino_Tensor_asFloat(JNIEnv *, jobject, jlong);
     JNIEXPORT jintArray JNICALL Java_org_intel_openvino_Tensor_asInt(JNIEnv *, jobject, jlong);
+    JNIEXPORT jint JNICALL Java_org_intel_openvino_Tensor_GetElementType(JNIEnv *, jobject, jlong);
+    JNIEXPORT jobject JNICALL Java_org_intel_openvino_Tensor_asByteBuffer(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToByteArray(JNIEnv *, jobject, jlong, jbyteArray);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToShortArray(JNIEnv *, jobject, jlong, jshortArray);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToIntArray(JNIEnv *, jobject, jlong, jintArray);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToLongArray(JNIEnv *, jobject, jlong, jlongArray);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToFloatArray(JNIEnv *, jobject, jlong, jfloatArray);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToDoubleArray(JNIEnv *, jobject, jlong, jdoubleArray);
     JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_delete(JNIEnv *, jobject, jlong);
 
     // ov::PrePostProcessor
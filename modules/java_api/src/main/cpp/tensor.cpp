@@ -9,6 +9,76 @@
 
 using namespace ov;
 
+namespace {
+// Lends the memory of a direct java.nio.ByteBuffer to ov::Tensor instead of allocating it. The buffer is kept alive by
+// a global reference until the tensor and all of its copies (e.g. the ones held by an infer request) are destroyed.
+class DirectBufferAllocator
+{
+public:
+    DirectBufferAllocator(JNIEnv *env, jobject buffer)
+    {
+        m_address = env->GetDirectBufferAddress(buffer);
+        m_capacity = env->GetDirectBufferCapacity(buffer);
+        if (!m_address || m_capacity < 0)
+            throw std::runtime_error("The ByteBuffer is not a direct buffer!");
+
+        JavaVM *vm = nullptr;
+        env->GetJavaVM(&vm);
+        jobject buffer_ref = env->NewGlobalRef(buffer);
+        m_buffer_ref = std::shared_ptr<_jobject>(buffer_ref, [vm](jobject ref) {
+            get_thread_env(vm)->DeleteGlobalRef(ref);
+        });
+    }
+
+    void *allocate(size_t bytes, size_t)
+    {
+        if (bytes > static_cast<size_t>(m_capacity))
+            throw std::runtime_error("The ByteBuffer capacity is less than the tensor byte size!");
+        return m_address;
+    }
+
+    // the memory belongs to the buffer, the reference to which is dropped along with the last copy of the allocator:
+    // the tensor may allocate again after a deallocation, e.g. when its shape is changed
+    void deallocate(void *, size_t, size_t)
+    {
+    }
+
+    bool is_equal(const DirectBufferAllocator &other) const
+    {
+        return m_address == other.m_address;
+    }
+
+private:
+    void *m_address = nullptr;
+    jlong m_capacity = 0;
+    std::shared_ptr<_jobject> m_buffer_ref;
+};
+
+// Copies the first `count` elements of the tensor data into the Java array with a single Set<Type>ArrayRegion call
+template <typename JArray, typename JType>
+void copy_to_array(JNIEnv *env,
+                   const Tensor &tensor,
+                   JArray array,
+                   size_t count,
+                   void (JNIEnv::*set_array_region)(JArray, jsize, jsize, const JType *))
+{
+    if (!tensor.is_continuous())
+        throw std::runtime_error("Only continuous tensors can be copied to an array!");
+    if (static_cast<size_t>(env->GetArrayLength(array)) < count)
+        throw std::runtime_error("The array is smaller than the tensor!");
+    (env->*set_array_region)(array, 0, count, static_cast<const JType *>(tensor.data()));
+}
+
+// The types of the same width share the Java array type, e.g. both i64 and u64 tensors are copied to long[], and the f16
+// and bf16 ones may be copied to short[] as the raw bits
+void check_element_size(const Tensor &tensor, size_t element_size, bool allow_real)
+{
+    const element::Type &type = tensor.get_element_type();
+    if (type.bitwidth() != element_size * 8 || (type.is_real() && !allow_real))
+        throw std::runtime_error("The tensor element type " + type.get_type_name() + " does not match the array type!");
+}
+} // namespace
+
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorCArray(JNIEnv *env, jobject, jint type, jintArray shape, jlong matDataAddr)
 {
     JNI_METHOD(
@@ -41,6 +111,19 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorCArray(JNIEnv *env,
     return 0;
 }
 
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorDirectBuffer(JNIEnv *env, jobject, jint type, jintArray shape, jobject buffer)
+{
+    JNI_METHOD(
+        "TensorDirectBuffer",
+        auto input_type = get_ov_type(type);
+        Shape input_shape = jintArrayToVector(env, shape);
+        Tensor *ov_tensor = new Tensor(input_type, input_shape, Allocator(DirectBufferAllocator(env, buffer)));
+
+        return (jlong)ov_tensor;
+    )
+    return 0;
+}
+
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorFloat(JNIEnv *env, jobject, jintArray shape, jfloatArray data)
 {
     JNI_METHOD(
@@ -114,6 +197,16 @@ JNIEXPORT jintArray JNICALL Java_org_intel_openvino_Tensor_GetShape(JNIEnv *env,
     return 0;
 }
 
+JNIEXPORT jint JNICALL Java_org_intel_openvino_Tensor_GetElementType(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD(
+        "GetElementType",
+        Tensor *ov_tensor = (Tensor *)addr;
+        return static_cast<jint>(element::Type_t(ov_tensor->get_element_type()));
+    )
+    return 0;
+}
+
 JNIEXPORT jfloatArray JNICALL Java_org_intel_openvino_Tensor_asFloat(JNIEnv *env, jobject, jlong addr)
 {
     JNI_METHOD(
@@ -126,12 +219,8 @@ JNIEXPORT jfloatArray JNICALL Java_org_intel_openvino_Tensor_asFloat(JNIEnv *env
         jfloatArray result = env->NewFloatArray(size);
         if (!result) {
             throw std::runtime_error("Out of memory!");
-        } jfloat *arr = env->GetFloatArrayElements(result, nullptr);
-
-        for (size_t i = 0; i < size; ++i)
-            arr[i] = data[i];
-
-        env->ReleaseFloatArrayElements(result, arr, 0);
+        }
+        env->SetFloatArrayRegion(result, 0, size, data);
         return result;
     )
     return 0;
@@ -149,17 +238,106 @@ JNIEXPORT jintArray JNICALL Java_org_intel_openvino_Tensor_asInt(JNIEnv *env, jo
         jintArray result = env->NewIntArray(size);
         if (!result) {
             throw std::runtime_error("Out of memory!");
-        } jint *arr = env->GetIntArrayElements(result, nullptr);
+        }
+        env->SetIntArrayRegion(result, 0, size, data);
+        return result;
+    )
+    return 0;
+}
 
-        for (size_t i = 0; i < size; ++i)
-            arr[i] = data[i];
+JNIEXPORT jobject JNICALL Java_org_intel_openvino_Tensor_asByteBuffer(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD(
+        "asByteBuffer",
+        Tensor *ov_tensor = (Tensor *)addr;
+        if (!ov_tensor->is_continuous())
+            throw std::runtime_error("Only continuous tensors can be viewed as a ByteBuffer!");
 
-        env->ReleaseIntArrayElements(result, arr, 0);
+        jobject result = env->NewDirectByteBuffer(ov_tensor->data(), ov_tensor->get_byte_size());
+        if (!result) {
+            throw std::runtime_error("Direct buffers are not supported by the JVM!");
+        }
         return result;
     )
     return 0;
 }
 
+JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToByteArray(JNIEnv *env, jobject, jlong addr, jbyteArray array)
+{
+    JNI_METHOD(
+        "copyToByteArray",
+        Tensor *ov_tensor = (Tensor *)addr;
+        // the raw bytes of any element type, including the ones smaller than a byte
+        copy_to_array(env, *ov_tensor, array, ov_tensor->get_byte_size(), &JNIEnv::SetByteArrayRegion);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToShortArray(JNIEnv *env, jobject, jlong addr, jshortArray array)
+{
+    JNI_METHOD(
+        "copyToShortArray",
+        Tensor *ov_tensor = (Tensor *)addr;
+        check_element_size(*ov_tensor, sizeof(jshort), true);
+        copy_to_array(env, *ov_tensor, array, ov_tensor->get_size(), &JNIEnv::SetShortArrayRegion);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToIntArray(JNIEnv *env, jobject, jlong addr, jintArray array)
+{
+    JNI_METHOD(
+        "copyToIntArray",
+        Tensor *ov_tensor = (Tensor *)addr;
+        check_element_size(*ov_tensor, sizeof(jint), false);
+        copy_to_array(env, *ov_tensor, array, ov_tensor->get_size(), &JNIEnv::SetIntArrayRegion);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToLongArray(JNIEnv *env, jobject, jlong addr, jlongArray array)
+{
+    JNI_METHOD(
+        "copyToLongArray",
+        Tensor *ov_tensor = (Tensor *)addr;
+        check_element_size(*ov_tensor, sizeof(jlong), false);
+        copy_to_array(env, *ov_tensor, array, ov_tensor->get_size(), &JNIEnv::SetLongArrayRegion);
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToFloatArray(JNIEnv *env, jobject, jlong addr, jfloatArray array)
+{
+    JNI_METHOD(
+        "copyToFloatArray",
+        Tensor *ov_tensor = (Tensor *)addr;
+        element::Type type = ov_tensor->get_element_type();
+        if (type == element::f16 || type == element::bf16) {
+            // the half precision values are widened, which takes a temporary buffer
+            size_t size = ov_tensor->get_size();
+            if (static_cast<size_t>(env->GetArrayLength(array)) < size)
+                throw std::runtime_error("The array is smaller than the tensor!");
+            std::vector<float> values(size);
+            if (type == element::f16)
+                std::copy_n(ov_tensor->data<const float16>(), size, values.begin());
+            else
+                std::copy_n(ov_tensor->data<const bfloat16>(), size, values.begin());
+            env->SetFloatArrayRegion(array, 0, size, values.data());
+        } else {
+            if (type != element::f32)
+                throw std::runtime_error("Only f32, f16 and bf16 tensors can be copied to a float array!");
+            copy_to_array(env, *ov_tensor, array, ov_tensor->get_size(), &JNIEnv::SetFloatArrayRegion);
+        }
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_copyToDoubleArray(JNIEnv *env, jobject, jlong addr, jdoubleArray array)
+{
+    JNI_METHOD(
+        "copyToDoubleArray",
+        Tensor *ov_tensor = (Tensor *)addr;
+        if (ov_tensor->get_element_type() != element::f64)
+            throw std::runtime_error("Only f64 tensors can be copied to a double array!");
+        copy_to_array(env, *ov_tensor, array, ov_tensor->get_size(), &JNIEnv::SetDoubleArrayRegion);
+    )
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_Tensor_delete(JNIEnv *, jobject, jlong addr)
 {
     Tensor *tensor = (Tensor *)addr;
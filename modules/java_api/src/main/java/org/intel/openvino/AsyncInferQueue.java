@@ -0,0 +1,135 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino;
+
+/**
+ * A queue of inference requests which keeps a device saturated: each inference is started on an
+ * idle request of the queue, and its completion is delivered to the callback of the queue.
+ *
+ * <p>This is the counterpart of the AsyncInferQueue of the OpenVINO Python API:
+ *
+ * <pre>{@code
+ * AsyncInferQueue queue = new AsyncInferQueue(compiledModel);
+ * queue.set_callback(
+ *         (request, userdata, exception) -> {
+ *             results[(Integer) userdata] = request.get_output_tensor().data();
+ *         });
+ * for (int i = 0; i < inputs.length; i++) {
+ *     queue.start_async(inputs[i], i);
+ * }
+ * queue.wait_all();
+ * }</pre>
+ *
+ * <p>The idle requests are handed out without locking, so {@link #start_async(Tensor, Object)}
+ * may be called by several threads.
+ */
+public class AsyncInferQueue extends Wrapper {
+
+    /**
+     * Creates a queue of inference requests of the compiled model.
+     *
+     * @param model the compiled model to create the requests of
+     * @param jobs number of requests, or 0 to use the optimal number of infer requests reported by
+     *     the device
+     */
+    public AsyncInferQueue(CompiledModel model, int jobs) {
+        super(Create(model.nativeObj, jobs));
+    }
+
+    /**
+     * Creates a queue with the optimal number of inference requests reported by the device.
+     *
+     * @param model the compiled model to create the requests of
+     */
+    public AsyncInferQueue(CompiledModel model) {
+        this(model, 0);
+    }
+
+    /** @return number of requests in the queue */
+    public int get_size() {
+        return GetSize(nativeObj);
+    }
+
+    /** @return {@code true} if there is an idle request, i.e. the next inference starts at once */
+    public boolean is_ready() {
+        return IsReady(nativeObj);
+    }
+
+    /**
+     * Waits until there is an idle request.
+     *
+     * @return the ID of an idle request
+     */
+    public int get_idle_request_id() {
+        return GetIdleRequestId(nativeObj);
+    }
+
+    /**
+     * Gets a request of the queue, e.g. to set the tensors shared by all the inferences. The
+     * callback of the request must not be replaced, as the queue relies on it. The inferences
+     * started on the request directly are not passed to the callback of the queue.
+     *
+     * @param id ID of the request, from 0 to {@link #get_size()} - 1
+     * @return the request
+     */
+    public InferRequest get_request(int id) {
+        return GetRequest(nativeObj, id);
+    }
+
+    /**
+     * Sets the callback invoked upon the completion of each inference. It cannot be replaced while
+     * inferences are running.
+     *
+     * @param callback the callback, or {@code null} to remove the current one
+     */
+    public void set_callback(AsyncInferQueueCallback callback) {
+        SetCallback(nativeObj, callback);
+    }
+
+    /**
+     * Starts the inference of a model with a single input on an idle request, waiting for one if
+     * all the requests are busy.
+     *
+     * @param input the input tensor, which must not be modified until the inference is completed
+     * @param userdata any object to pass to the callback along with the request
+     */
+    public void start_async(Tensor input, Object userdata) {
+        StartAsync(nativeObj, input.nativeObj, userdata);
+    }
+
+    /**
+     * Starts the inference of a model with a single input on an idle request, waiting for one if
+     * all the requests are busy.
+     *
+     * @param input the input tensor, which must not be modified until the inference is completed
+     */
+    public void start_async(Tensor input) {
+        start_async(input, null);
+    }
+
+    /** Waits until all the inferences are completed and their callbacks have returned. */
+    public void wait_all() {
+        WaitAll(nativeObj);
+    }
+
+    /*----------------------------------- native methods -----------------------------------*/
+    private static native long Create(long modelAddr, int jobs);
+
+    private static native int GetSize(long addr);
+
+    private static native boolean IsReady(long addr);
+
+    private static native int GetIdleRequestId(long addr);
+
+    private static native InferRequest GetRequest(long addr, int id);
+
+    private static native void SetCallback(long addr, AsyncInferQueueCallback callback);
+
+    private static native void StartAsync(long addr, long tensorAddr, Object userdata);
+
+    private static native void WaitAll(long addr);
+
+    @Override
+    protected native void delete(long nativeObj);
+}
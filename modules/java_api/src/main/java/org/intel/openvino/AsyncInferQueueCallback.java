@@ -0,0 +1,22 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino;
+
+/**
+ * Callback invoked upon the completion of each inference started by {@link
+ * AsyncInferQueue#start_async(Tensor, Object)}.
+ *
+ * <p>The callback is called on an OpenVINO thread and the request stays busy until it returns, so
+ * it should only read the results and must not call the blocking methods of the queue. The
+ * exceptions thrown by the callback are printed and otherwise ignored.
+ */
+@FunctionalInterface
+public interface AsyncInferQueueCallback {
+    /**
+     * @param request the request of the queue the inference ran on, e.g. to read its outputs
+     * @param userdata the object passed to {@link AsyncInferQueue#start_async(Tensor, Object)}
+     * @param exception {@code null} if the inference succeeded, otherwise the reason of the failure
+     */
+    void onComplete(InferRequest request, Object userdata, Exception exception);
+}
@@ -3,7 +3,14 @@
 
 package org.intel.openvino;
 
-/** This is a class of infer request that can be run in asynchronous or synchronous manners. */
+import java.util.concurrent.CompletableFuture;
+
+/**
+ * This is a class of infer request that can be run in asynchronous or synchronous manners.
+ *
+ * <p>A request must not be used by several threads at a time; the threads running inferences
+ * concurrently should either create requests of their own or share an {@link InferRequestPool}.
+ */
 public class InferRequest extends Wrapper {
 
     private boolean isReleased = false;
@@ -57,6 +64,44 @@ public class InferRequest extends Wrapper {
         Wait(nativeObj);
     }
 
+    /**
+     * Sets a callback to be called upon the completion of each subsequent asynchronous inference,
+     * so that no thread has to be blocked in {@link #wait_async()}.
+     *
+     * <p>The callback is called on an OpenVINO thread; see {@link InferRequestCallback}. The
+     * callback is referenced by the native request until it is replaced or the request is
+     * released, so it should not capture the request itself.
+     *
+     * @param callback the callback, or {@code null} to remove the current one
+     */
+    public void set_callback(InferRequestCallback callback) {
+        SetCallback(nativeObj, callback);
+    }
+
+    /**
+     * Starts inference of specified input(s) in asynchronous mode and returns a future completed
+     * along with it. Replaces the callback set by {@link #set_callback(InferRequestCallback)}.
+     *
+     * <p>The dependent actions of the future run on the OpenVINO thread completing it unless an
+     * executor is passed to the {@code *Async} methods of the future.
+     *
+     * @return the future completed normally when the inference succeeds, or exceptionally with the
+     *     reason of the failure
+     */
+    public CompletableFuture<Void> infer_async() {
+        final CompletableFuture<Void> future = new CompletableFuture<Void>();
+        set_callback(
+                exception -> {
+                    if (exception == null) {
+                        future.complete(null);
+                    } else {
+                        future.completeExceptionally(exception);
+                    }
+                });
+        start_async();
+        return future;
+    }
+
     /**
      * Sets an output tensor to infer models with single output.
      *
@@ -106,6 +151,8 @@ public class InferRequest extends Wrapper {
 
     private static native void Wait(long addr);
 
+    private static native void SetCallback(long addr, InferRequestCallback callback);
+
     private static native void SetInputTensor(long addr, long tensorAddr);
 
     private static native void SetOutputTensor(long addr, long tensorAddr);
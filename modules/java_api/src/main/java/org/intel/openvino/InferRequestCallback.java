@@ -0,0 +1,20 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino;
+
+/**
+ * Callback invoked upon the completion of an asynchronous inference started by {@link
+ * InferRequest#start_async()}.
+ *
+ * <p>The callback is called on an OpenVINO thread, so it should return quickly and must not call
+ * the blocking methods of the same {@link InferRequest}. The exceptions thrown by the callback are
+ * printed and otherwise ignored.
+ */
+@FunctionalInterface
+public interface InferRequestCallback {
+    /**
+     * @param exception {@code null} if the inference succeeded, otherwise the reason of the failure
+     */
+    void onComplete(Exception exception);
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino;
+
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.Executor;
+import java.util.function.BiConsumer;
+
+/**
+ * A pool of inference requests of a compiled model, which may be shared by any number of threads
+ * without external synchronization.
+ *
+ * <p>An {@link InferRequest} must not be used by several threads at a time. The pool runs each
+ * inference on a request of its own instead, so concurrent callers run in parallel on up to
+ * {@link #get_size()} requests and the other ones wait until a request becomes idle. The waiting
+ * and the inference happen in native code, which does not block the garbage collector or the
+ * other Java threads.
+ *
+ * <p>The methods of the pool return copies of the output tensor, which stay valid after the
+ * request is reused.
+ */
+public class InferRequestPool extends Wrapper {
+
+    /**
+     * Creates a pool of inference requests of the compiled model.
+     *
+     * @param model the compiled model to create the requests of
+     * @param size number of requests, or 0 to use the optimal number of infer requests reported by
+     *     the device
+     */
+    public InferRequestPool(CompiledModel model, int size) {
+        super(Create(model.nativeObj, size));
+    }
+
+    /**
+     * Creates a pool with the optimal number of inference requests reported by the device.
+     *
+     * @param model the compiled model to create the requests of
+     */
+    public InferRequestPool(CompiledModel model) {
+        this(model, 0);
+    }
+
+    /** @return number of requests in the pool, i.e. the maximum number of parallel inferences */
+    public int get_size() {
+        return GetSize(nativeObj);
+    }
+
+    /**
+     * Infers a model with a single input and a single output, blocking the calling thread.
+     *
+     * @param input the input tensor
+     * @return a copy of the output tensor
+     */
+    public Tensor infer(Tensor input) {
+        return new Tensor(Infer(nativeObj, input.nativeObj));
+    }
+
+    /**
+     * Starts the inference of a model with a single input and a single output. Blocks only while
+     * all the requests of the pool are busy.
+     *
+     * <p>The future is completed on the default asynchronous execution facility of {@link
+     * CompletableFuture} rather than on the OpenVINO thread that finishes the inference, so its
+     * dependent actions may block and use the pool again, e.g. to chain inferences with {@code
+     * thenCompose}.
+     *
+     * @param input the input tensor, which must not be modified until the future is completed
+     * @return the future completed with a copy of the output tensor, or exceptionally with the
+     *     reason of the failure
+     */
+    public CompletableFuture<Tensor> infer_async(Tensor input) {
+        CompletableFuture<Tensor> future = new CompletableFuture<Tensor>();
+        startInferAsync(input).whenCompleteAsync(relayTo(future));
+        return future;
+    }
+
+    /**
+     * Starts the inference of a model with a single input and a single output, like {@link
+     * #infer_async(Tensor)}, completing the future on the given executor.
+     *
+     * @param input the input tensor, which must not be modified until the future is completed
+     * @param executor the executor to complete the future on
+     * @return the future completed with a copy of the output tensor, or exceptionally with the
+     *     reason of the failure
+     */
+    public CompletableFuture<Tensor> infer_async(Tensor input, Executor executor) {
+        CompletableFuture<Tensor> future = new CompletableFuture<Tensor>();
+        startInferAsync(input).whenCompleteAsync(relayTo(future), executor);
+        return future;
+    }
+
+    // The native completion runs on the OpenVINO thread before the request is handed out again: a
+    // dependent action waiting there for a request of the pool could wait for its own completion.
+    private CompletableFuture<Tensor> startInferAsync(Tensor input) {
+        CompletableFuture<Tensor> completion = new CompletableFuture<Tensor>();
+        InferAsync(nativeObj, input.nativeObj, completion);
+        return completion;
+    }
+
+    private static BiConsumer<Tensor, Throwable> relayTo(CompletableFuture<Tensor> future) {
+        return (tensor, exception) -> {
+            if (exception == null) {
+                future.complete(tensor);
+            } else {
+                future.completeExceptionally(exception);
+            }
+        };
+    }
+
+    /*----------------------------------- native methods -----------------------------------*/
+    private static native long Create(long modelAddr, int size);
+
+    private static native int GetSize(long addr);
+
+    private static native long Infer(long addr, long tensorAddr);
+
+    private static native void InferAsync(
+            long addr, long tensorAddr, CompletableFuture<Tensor> future);
+
+    @Override
+    protected native void delete(long nativeObj);
+}
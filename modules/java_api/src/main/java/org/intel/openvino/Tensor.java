@@ -3,6 +3,9 @@
 
 package org.intel.openvino;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
 /**
  * Tensor API holding host memory
  *
@@ -18,6 +21,24 @@ public class Tensor extends Wrapper {
         super(TensorCArray(type.getValue(), dims, cArray));
     }
 
+    /**
+     * Constructs a {@link Tensor} over the memory of the given direct {@link ByteBuffer} without
+     * copying it.
+     *
+     * <p>The tensor data starts at the beginning of the buffer regardless of its position, and the
+     * element byte order is the native one, so the buffer is typically created with {@code
+     * ByteBuffer.allocateDirect(size).order(ByteOrder.nativeOrder())}. The buffer is kept alive
+     * for as long as the tensor (or an infer request it was set to) uses it, so the inputs may be
+     * filled in place between inferences.
+     *
+     * @param type element type of the tensor
+     * @param dims shape of the tensor
+     * @param buffer a direct buffer of at least the tensor byte size
+     */
+    public Tensor(ElementType type, int[] dims, ByteBuffer buffer) {
+        super(TensorDirectBuffer(type.getValue(), dims, checkDirect(buffer)));
+    }
+
     public Tensor(int[] dims, float[] data) {
         super(TensorFloat(dims, data));
     }
@@ -66,9 +87,93 @@ public class Tensor extends Wrapper {
         return asInt(nativeObj);
     }
 
+    /** Returns the element type of the tensor. */
+    public ElementType get_element_type() {
+        return ElementType.valueOf(GetElementType(nativeObj));
+    }
+
+    /**
+     * Returns a direct {@link ByteBuffer} over the tensor memory in the native byte order, without
+     * copying it.
+     *
+     * <p>The view is only valid for as long as this {@link Tensor} object is reachable, and, for
+     * the tensors obtained from an {@link InferRequest}, until the request reallocates the tensor
+     * (e.g. due to a new input shape). Typed views are available through e.g. {@link
+     * ByteBuffer#asFloatBuffer()}.
+     */
+    public ByteBuffer as_byte_buffer() {
+        return asByteBuffer(nativeObj).order(ByteOrder.nativeOrder());
+    }
+
+    /**
+     * Copies the raw bytes of the tensor data, of any element type, into the given array.
+     *
+     * @param dst an array of at least the tensor byte size, which may be reused between calls
+     */
+    public void copy_to(byte[] dst) {
+        copyToByteArray(nativeObj, dst);
+    }
+
+    /**
+     * Copies the data of a 16-bit tensor (i16, u16, or the raw bits of f16 and bf16) into the given
+     * array.
+     *
+     * @param dst an array of at least the tensor size, which may be reused between calls
+     */
+    public void copy_to(short[] dst) {
+        copyToShortArray(nativeObj, dst);
+    }
+
+    /**
+     * Copies the data of an i32 or u32 tensor into the given array.
+     *
+     * @param dst an array of at least the tensor size, which may be reused between calls
+     */
+    public void copy_to(int[] dst) {
+        copyToIntArray(nativeObj, dst);
+    }
+
+    /**
+     * Copies the data of an i64 or u64 tensor into the given array.
+     *
+     * @param dst an array of at least the tensor size, which may be reused between calls
+     */
+    public void copy_to(long[] dst) {
+        copyToLongArray(nativeObj, dst);
+    }
+
+    /**
+     * Copies the data of an f32 tensor into the given array; the f16 and bf16 tensor values are
+     * converted to float.
+     *
+     * @param dst an array of at least the tensor size, which may be reused between calls
+     */
+    public void copy_to(float[] dst) {
+        copyToFloatArray(nativeObj, dst);
+    }
+
+    /**
+     * Copies the data of an f64 tensor into the given array.
+     *
+     * @param dst an array of at least the tensor size, which may be reused between calls
+     */
+    public void copy_to(double[] dst) {
+        copyToDoubleArray(nativeObj, dst);
+    }
+
+    private static ByteBuffer checkDirect(ByteBuffer buffer) {
+        if (!buffer.isDirect()) {
+            throw new IllegalArgumentException(
+                    "The tensor can only be created over a direct buffer");
+        }
+        return buffer;
+    }
+
     /*----------------------------------- native methods -----------------------------------*/
     private static native long TensorCArray(int type, int[] shape, long cArray);
 
+    private static native long TensorDirectBuffer(int type, int[] shape, ByteBuffer buffer);
+
     private static native long TensorFloat(int[] shape, float[] data);
 
     private static native long TensorInt(int[] shape, int[] data);
@@ -83,6 +188,22 @@ public class Tensor extends Wrapper {
 
     private static native int GetSize(long addr);
 
+    private static native int GetElementType(long addr);
+
+    private static native ByteBuffer asByteBuffer(long addr);
+
+    private static native void copyToByteArray(long addr, byte[] dst);
+
+    private static native void copyToShortArray(long addr, short[] dst);
+
+    private static native void copyToIntArray(long addr, int[] dst);
+
+    private static native void copyToLongArray(long addr, long[] dst);
+
+    private static native void copyToFloatArray(long addr, float[] dst);
+
+    private static native void copyToDoubleArray(long addr, double[] dst);
+
     @Override
     protected native void delete(long nativeObj);
 }
@@ -0,0 +1,88 @@
+package org.intel.openvino;
+
+import static org.junit.Assert.*;
+
+import org.junit.Before;
+import org.junit.Test;
+
+import java.util.Arrays;
+import java.util.concurrent.atomic.AtomicInteger;
+
+public class AsyncInferQueueTests extends OVTest {
+
+    private CompiledModel model;
+    private Tensor input;
+
+    @Before
+    public void init() {
+        Core core = new Core();
+        model = core.compile_model(modelXml, device);
+
+        float[] inputData = new float[3 * 32 * 32];
+        Arrays.fill(inputData, 1);
+        input = new Tensor(new int[] {1, 3, 32, 32}, inputData);
+    }
+
+    @Test
+    public void testSize() {
+        assertTrue(new AsyncInferQueue(model).get_size() > 0);
+
+        AsyncInferQueue queue = new AsyncInferQueue(model, 3);
+        assertEquals(3, queue.get_size());
+        assertTrue(queue.is_ready());
+        int id = queue.get_idle_request_id();
+        assertTrue(id >= 0 && id < 3);
+        assertNotNull(queue.get_request(id));
+    }
+
+    @Test
+    public void testCallbacks() {
+        InferRequest reference = model.create_infer_request();
+        reference.set_input_tensor(input);
+        reference.infer();
+        float[] expected = reference.get_output_tensor().data();
+
+        // more inferences than requests, so that the requests are reused
+        AsyncInferQueue queue = new AsyncInferQueue(model, 2);
+        float[][] results = new float[8][];
+        Exception[] errors = new Exception[results.length];
+        queue.set_callback(
+                (request, userdata, exception) -> {
+                    int index = (Integer) userdata;
+                    errors[index] = exception;
+                    results[index] = request.get_output_tensor().data();
+                });
+        for (int i = 0; i < results.length; i++) {
+            queue.start_async(input, i);
+        }
+        queue.wait_all();
+
+        assertTrue(queue.is_ready());
+        for (int i = 0; i < results.length; i++) {
+            assertNull(errors[i]);
+            assertArrayEquals(expected, results[i], 0.0f);
+        }
+    }
+
+    @Test
+    public void testRequestStartedOutsideOfQueue() {
+        AsyncInferQueue queue = new AsyncInferQueue(model, 2);
+        AtomicInteger calls = new AtomicInteger();
+        queue.set_callback((request, userdata, exception) -> calls.incrementAndGet());
+
+        // the completion of an inference started directly is not delivered to the queue callback
+        InferRequest request = queue.get_request(queue.get_idle_request_id());
+        request.set_input_tensor(input);
+        request.start_async();
+        request.wait_async();
+        request.start_async();
+        request.wait_async();
+
+        for (int i = 0; i < 4; i++) {
+            queue.start_async(input);
+        }
+        queue.wait_all();
+        assertEquals(4, calls.get());
+        assertTrue(queue.is_ready());
+    }
+}
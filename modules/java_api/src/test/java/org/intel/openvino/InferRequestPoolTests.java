@@ -0,0 +1,85 @@
+package org.intel.openvino;
+
+import static org.junit.Assert.*;
+
+import org.junit.Before;
+import org.junit.Test;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.TimeUnit;
+
+public class InferRequestPoolTests extends OVTest {
+
+    private CompiledModel model;
+    private Tensor input;
+
+    @Before
+    public void init() {
+        Core core = new Core();
+        model = core.compile_model(modelXml, device);
+
+        float[] inputData = new float[3 * 32 * 32];
+        Arrays.fill(inputData, 1);
+        input = new Tensor(new int[] {1, 3, 32, 32}, inputData);
+    }
+
+    @Test
+    public void testSize() {
+        assertTrue(new InferRequestPool(model).get_size() > 0);
+        assertEquals(3, new InferRequestPool(model, 3).get_size());
+    }
+
+    @Test
+    public void testConcurrentInfer() throws Exception {
+        InferRequestPool pool = new InferRequestPool(model, 2);
+        float[] reference = pool.infer(input).data();
+        assertEquals(10, reference.length);
+
+        ExecutorService executor = Executors.newFixedThreadPool(8);
+        List<Future<float[]>> results = new ArrayList<Future<float[]>>();
+        for (int i = 0; i < 32; i++) {
+            results.add(executor.submit(() -> pool.infer(input).data()));
+        }
+        for (Future<float[]> result : results) {
+            assertArrayEquals(reference, result.get(10, TimeUnit.SECONDS), 0.0f);
+        }
+        executor.shutdown();
+    }
+
+    @Test
+    public void testInferAsync() throws Exception {
+        InferRequestPool pool = new InferRequestPool(model, 2);
+        float[] reference = pool.infer(input).data();
+
+        // more inferences than requests, so that the requests are reused
+        List<CompletableFuture<Tensor>> futures = new ArrayList<CompletableFuture<Tensor>>();
+        for (int i = 0; i < 8; i++) {
+            futures.add(pool.infer_async(input));
+        }
+        for (CompletableFuture<Tensor> future : futures) {
+            assertArrayEquals(reference, future.get(10, TimeUnit.SECONDS).data(), 0.0f);
+        }
+    }
+
+    @Test
+    public void testChainedInferAsync() throws Exception {
+        // a single request, so that the chained inference needs the request of the first one
+        InferRequestPool pool = new InferRequestPool(model, 1);
+        float[] reference = pool.infer(input).data();
+
+        CompletableFuture<Tensor> future =
+                pool.infer_async(input).thenCompose(tensor -> pool.infer_async(input));
+        assertArrayEquals(reference, future.get(10, TimeUnit.SECONDS).data(), 0.0f);
+
+        ExecutorService executor = Executors.newSingleThreadExecutor();
+        future = pool.infer_async(input, executor).thenApply(tensor -> pool.infer(input));
+        assertArrayEquals(reference, future.get(10, TimeUnit.SECONDS).data(), 0.0f);
+        executor.shutdown();
+    }
+}
@@ -0,0 +1,66 @@
+package org.intel.openvino;
+
+import static org.junit.Assert.*;
+
+import org.junit.Before;
+import org.junit.Test;
+
+import java.util.Arrays;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicReference;
+
+public class InferRequestTests extends OVTest {
+
+    private CompiledModel model;
+
+    @Before
+    public void init() {
+        Core core = new Core();
+        model = core.compile_model(modelXml, device);
+    }
+
+    private InferRequest createRequest() {
+        InferRequest request = model.create_infer_request();
+        float[] inputData = new float[3 * 32 * 32];
+        Arrays.fill(inputData, 1);
+        request.set_input_tensor(new Tensor(new int[] {1, 3, 32, 32}, inputData));
+        return request;
+    }
+
+    @Test
+    public void testCallback() throws InterruptedException {
+        InferRequest request = createRequest();
+        CountDownLatch done = new CountDownLatch(1);
+        AtomicReference<Exception> error = new AtomicReference<Exception>();
+
+        request.set_callback(
+                exception -> {
+                    error.set(exception);
+                    done.countDown();
+                });
+        request.start_async();
+
+        assertTrue(done.await(10, TimeUnit.SECONDS));
+        assertNull(error.get());
+        assertEquals(10, request.get_output_tensor().get_size());
+    }
+
+    @Test
+    public void testInferAsyncFutures() throws Exception {
+        InferRequest[] requests = new InferRequest[4];
+        CompletableFuture<?>[] futures = new CompletableFuture<?>[requests.length];
+        for (int i = 0; i < requests.length; i++) {
+            requests[i] = createRequest();
+            futures[i] = requests[i].infer_async();
+        }
+
+        CompletableFuture.allOf(futures).get(10, TimeUnit.SECONDS);
+
+        float[] reference = requests[0].get_output_tensor().data();
+        for (InferRequest request : requests) {
+            assertArrayEquals(reference, request.get_output_tensor().data(), 0.0f);
+        }
+    }
+}
@@ -4,6 +4,8 @@ import static org.junit.Assert.*;
 
 import org.junit.Test;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.Arrays;
 
 public class TensorTests extends OVTest {
@@ -42,4 +44,75 @@ public class TensorTests extends OVTest {
         assertArrayEquals(dimsArr, tensor.get_shape());
         assertEquals(size, tensor.get_size());
     }
+
+    @Test
+    public void testGetTensorFromDirectBuffer() {
+        ByteBuffer buffer =
+                ByteBuffer.allocateDirect(data.length * 4).order(ByteOrder.nativeOrder());
+        buffer.asFloatBuffer().put(data);
+
+        Tensor tensor = new Tensor(ElementType.f32, dimsArr, buffer);
+
+        assertArrayEquals(dimsArr, tensor.get_shape());
+        assertArrayEquals(data, tensor.data(), 0.0f);
+
+        // the tensor shares the memory with the buffer
+        buffer.putFloat(0, 42.0f);
+        assertEquals(42.0f, tensor.data()[0], 0.0f);
+    }
+
+    @Test(expected = Exception.class)
+    public void testGetTensorFromSmallDirectBuffer() {
+        ByteBuffer buffer =
+                ByteBuffer.allocateDirect(data.length * 4 - 1).order(ByteOrder.nativeOrder());
+        new Tensor(ElementType.f32, dimsArr, buffer);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testGetTensorFromHeapBuffer() {
+        new Tensor(ElementType.f32, dimsArr, ByteBuffer.allocate(data.length * 4));
+    }
+
+    @Test
+    public void testCopyToReusedArray() {
+        Tensor tensor = new Tensor(dimsArr, data);
+        float[] output = new float[data.length];
+
+        tensor.copy_to(output);
+        assertArrayEquals(data, output, 0.0f);
+        assertEquals(ElementType.f32, tensor.get_element_type());
+    }
+
+    @Test
+    public void testCopyToLongArray() {
+        long[] inputData = new long[data.length];
+        Arrays.fill(inputData, Long.MAX_VALUE);
+        Tensor tensor = new Tensor(dimsArr, inputData);
+
+        long[] output = new long[data.length];
+        tensor.copy_to(output);
+        assertArrayEquals(inputData, output);
+
+        byte[] bytes = new byte[data.length * 8];
+        tensor.copy_to(bytes);
+        assertEquals((byte) 0xFF, bytes[1]);
+    }
+
+    @Test(expected = Exception.class)
+    public void testCopyToMismatchedArray() {
+        new Tensor(dimsArr, data).copy_to(new int[data.length]);
+    }
+
+    @Test
+    public void testByteBufferView() {
+        Tensor tensor = new Tensor(dimsArr, data);
+        ByteBuffer view = tensor.as_byte_buffer();
+
+        assertEquals(data.length * 4, view.capacity());
+        assertEquals(data[3], view.asFloatBuffer().get(3), 0.0f);
+
+        // the view shares the memory with the tensor
+        view.putFloat(0, 42.0f);
+        assertEquals(42.0f, tensor.data()[0], 0.0f);
+    }
 }
@@ -4,9 +4,14 @@
 #ifndef LLAMA_CPP_COMPILED_MODEL_HPP
 #define LLAMA_CPP_COMPILED_MODEL_HPP
 
+#include "config.hpp"
+#include "cpu_partitioner.hpp"
+#include "gguf_converter.hpp"
 #include "llama.h"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
+#include "prefix_cache.hpp"
+#include "scheduler.hpp"
 
 namespace ov {
 namespace llama_cpp_plugin {
@@ -15,7 +20,18 @@ class LlamaCppPlugin;
 class LlamaCppState;
 class LlamaCppModel : public ICompiledModel {
 public:
-    LlamaCppModel(const std::string& gguf_fname, const std::shared_ptr<const IPlugin>& plugin, size_t num_threads = 0);
+    LlamaCppModel(const std::string& gguf_fname,
+                  const std::shared_ptr<const IPlugin>& plugin,
+                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
+                  const Config& config = {});
+    /**
+     * @brief Creates the compiled model from a GGUF file produced by the plugin (e.g. converted from an OpenVINO IR),
+     * which is kept for as long as the compiled model is alive and embedded into the exported model.
+     */
+    LlamaCppModel(const std::shared_ptr<TemporaryGgufFile>& gguf_file,
+                  const std::shared_ptr<const IPlugin>& plugin,
+                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
+                  const Config& config = {});
     /**
      * @brief Export compiled model to stream
      *
@@ -50,6 +66,11 @@ public:
     virtual const std::vector<ov::Output<const ov::Node>>& outputs() const override;
     virtual ~LlamaCppModel();
 
+    /**
+     * @brief Returns the parameters for the llama.cpp contexts created for this model
+     */
+    llama_context_params get_context_params() const;
+
 protected:
     /**
      * @brief Method creates infer request implementation
@@ -61,11 +82,19 @@ protected:
 private:
     gguf_context* m_gguf_ctx = nullptr;
     std::string m_gguf_fname;
-    size_t m_num_threads;
+    // only set if the GGUF file is owned by the compiled model; must outlive the llama.cpp model mapping the file
+    std::shared_ptr<TemporaryGgufFile> m_gguf_file;
+    Config m_config;
 
+    std::shared_ptr<llama_model> m_llama_model;  // possibly shared with other compiled models
     llama_model* m_llama_model_ptr = nullptr;
+    std::shared_ptr<llama_model> m_draft_llama_model;  // only set for the speculative decoding
     llama_context* m_llama_ctx = nullptr;
     std::shared_ptr<ov::Model> m_fake_model;
+    std::unique_ptr<PrefixCache> m_prefix_cache;
+    std::unique_ptr<LlamaCppScheduler> m_scheduler;
+    // the CPUs for the private contexts of the infer requests, one partition per each of the streams
+    std::unique_ptr<CpuPartitioner> m_cpu_partitioner;
 
     std::vector<ov::Output<const ov::Node>> m_fake_inputs;
     std::vector<ov::Output<const ov::Node>> m_fake_outputs;
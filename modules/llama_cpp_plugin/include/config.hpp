@@ -0,0 +1,55 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LLAMA_CPP_CONFIG_HPP
+#define LLAMA_CPP_CONFIG_HPP
+
+#include <string>
+#include <vector>
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+struct Config {
+    Config() = default;
+    Config(const ov::AnyMap& properties, const Config& defaults = {}, bool throw_on_unsupported = true);
+
+    void set_property(const ov::AnyMap& properties, bool throw_on_unsupported = true);
+    ov::Any get_property(const std::string& name) const;
+
+    static std::vector<ov::PropertyName> get_supported_properties();
+
+    size_t num_threads = 0;
+    bool logits_last_token_only = false;
+    size_t prefix_cache_size = 0;
+    size_t prefix_cache_min_tokens = 64;
+    bool continuous_batching = false;
+    uint32_t context_size = 0;
+    uint32_t batch_size = 0;
+    uint32_t micro_batch_size = 0;
+    std::string kv_cache_type = "f16";
+    uint32_t prefill_chunk_size = 0;
+    bool enable_profiling = false;
+    bool logits_output = true;
+    bool greedy_output = false;
+    uint32_t top_k_output = 0;
+    float sampling_temperature = 0.0f;
+    float sampling_top_p = 1.0f;
+    uint32_t sampling_seed = 0;
+    std::string draft_model;
+    uint32_t num_draft_tokens = 4;
+    bool context_shift = false;
+    uint32_t context_shift_sink_tokens = 4;
+    bool embeddings = false;
+    std::string pooling_type = "none";
+    int32_t num_streams = 1;
+    bool enable_cpu_pinning = false;
+    std::string conversion_weights_type = "f16";
+};
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
+
+#endif  // LLAMA_CPP_CONFIG_HPP
@@ -0,0 +1,64 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LLAMA_CPP_CPU_PARTITIONER_HPP
+#define LLAMA_CPP_CPU_PARTITIONER_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+/**
+ * @brief Splits the CPUs available to the process into disjoint partitions, one per each of the concurrently running
+ * infer requests, so that the llama.cpp worker threads of different requests do not compete for the same cores. The
+ * partitions do not cross the NUMA node boundaries unless there are fewer partitions than nodes.
+ */
+class CpuPartitioner {
+public:
+    explicit CpuPartitioner(size_t num_partitions);
+
+    /**
+     * @brief Returns the CPUs available to the process, grouped by their NUMA node; a single group if the NUMA
+     * topology is not known.
+     */
+    static std::vector<std::vector<int>> get_numa_node_cpus();
+
+    /**
+     * @brief Returns the index of the partition with the least number of users, which is incremented.
+     */
+    size_t acquire_partition();
+    void release_partition(size_t partition_idx);
+
+    const std::vector<int>& get_cpus(size_t partition_idx) const;
+    size_t get_num_partitions() const;
+
+private:
+    std::vector<std::vector<int>> m_partitions;
+    std::vector<size_t> m_num_users;
+    std::mutex m_mutex;
+};
+
+/**
+ * @brief Restricts the calling thread to the given CPUs for the lifetime of the object. The threads spawned by the
+ * calling thread in the meantime (such as the llama.cpp graph compute workers) inherit the restriction. Only has an
+ * effect on Linux.
+ */
+class ScopedCpuAffinity {
+public:
+    explicit ScopedCpuAffinity(const std::vector<int>& cpus);
+    ~ScopedCpuAffinity();
+
+    ScopedCpuAffinity(const ScopedCpuAffinity&) = delete;
+    ScopedCpuAffinity& operator=(const ScopedCpuAffinity&) = delete;
+
+private:
+    std::vector<int> m_previous_cpus;
+};
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
+
+#endif  // LLAMA_CPP_CPU_PARTITIONER_HPP
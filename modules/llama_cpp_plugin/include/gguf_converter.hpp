@@ -0,0 +1,69 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LLAMA_CPP_GGUF_CONVERTER_HPP
+#define LLAMA_CPP_GGUF_CONVERTER_HPP
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+/**
+ * @brief Converts a stateful decoder-only transformer IR of the LLaMA family (i.e. the topology exported by
+ * optimum-intel for LLaMA, Mistral, TinyLlama and similar models) into a GGUF file that llama.cpp can load. The
+ * hyperparameters are deduced from the weight shapes and the KV cache variables of the IR; since the IR does not carry
+ * a tokenizer, the GGUF gets a placeholder vocabulary of the same size, which is sufficient for the token ID based
+ * inputs and outputs of the plugin. Throws if the model is not recognized as such an IR.
+ *
+ * @param model OpenVINO model to convert, e.g. read from the IR with ov::Core::read_model
+ * @param gguf_fname path of the GGUF file to be written
+ * @param weights_type type of the matrix weights in the GGUF file - one of "f32", "f16" or "q8_0"
+ * @param context_length context length stored in the GGUF file, i.e. the default context size of the llama.cpp
+ * contexts
+ */
+void convert_model_to_gguf(const std::shared_ptr<const ov::Model>& model,
+                           const std::string& gguf_fname,
+                           const std::string& weights_type,
+                           uint32_t context_length);
+
+/**
+ * @brief A uniquely named GGUF file in the temporary directory which is removed along with the object, e.g. to hold
+ * the result of the IR conversion for as long as the compiled model is alive.
+ */
+class TemporaryGgufFile {
+public:
+    TemporaryGgufFile();
+    ~TemporaryGgufFile();
+
+    TemporaryGgufFile(const TemporaryGgufFile&) = delete;
+    TemporaryGgufFile& operator=(const TemporaryGgufFile&) = delete;
+
+    const std::string& get_path() const;
+
+private:
+    std::string m_path;
+};
+
+/**
+ * @brief Writes the entire contents of a GGUF file into the stream, so that the exported compiled model does not
+ * depend on the temporary file it was compiled from.
+ */
+void write_embedded_gguf(const std::string& gguf_fname, std::ostream& stream);
+
+/**
+ * @brief Reads the GGUF file contents written by write_embedded_gguf into a temporary file. Returns nullptr and leaves
+ * the stream position intact if the stream does not start with an embedded GGUF file.
+ */
+std::shared_ptr<TemporaryGgufFile> read_embedded_gguf(std::istream& stream);
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
+
+#endif  // LLAMA_CPP_GGUF_CONVERTER_HPP
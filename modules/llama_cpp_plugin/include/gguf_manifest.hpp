@@ -0,0 +1,46 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LLAMA_CPP_GGUF_MANIFEST_HPP
+#define LLAMA_CPP_GGUF_MANIFEST_HPP
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+/**
+ * @brief A small description of a GGUF file on disk which is stored in the OpenVINO model cache instead of the
+ * (potentially multi-GB) GGUF file contents. Upon import, the manifest is checked against the current state of the
+ * file so that stale cache entries are rejected and the model is recompiled from scratch.
+ */
+struct GgufManifest {
+    std::string path;
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    uint64_t hash = 0;
+
+    /**
+     * @brief Builds the manifest for an existing GGUF file
+     *
+     * @param gguf_fname path to the GGUF file
+     */
+    static GgufManifest from_file(const std::string& gguf_fname);
+
+    static GgufManifest read(std::istream& stream);
+    void write(std::ostream& stream) const;
+
+    /**
+     * @brief Checks that the file referenced by the manifest still exists and has the same size, modification time
+     * and content hash as at the time of the manifest creation. Throws if this is not the case.
+     */
+    void validate() const;
+};
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
+
+#endif  // LLAMA_CPP_GGUF_MANIFEST_HPP
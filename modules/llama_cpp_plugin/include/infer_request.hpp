@@ -4,15 +4,21 @@
 #ifndef LLAMA_CPP_INFER_REQUEST_HPP
 #define LLAMA_CPP_INFER_REQUEST_HPP
 
+#include <chrono>
+#include <functional>
+#include <vector>
+
 #include "compiled_model.hpp"
 #include "openvino/openvino.hpp"
+#include "sampler.hpp"
+#include "state.hpp"
 
 namespace ov {
 namespace llama_cpp_plugin {
 
 class LlamaCppSyncInferRequest : public ISyncInferRequest {
 public:
-    explicit LlamaCppSyncInferRequest(const std::shared_ptr<const LlamaCppModel>& compiled_model, size_t num_threads);
+    explicit LlamaCppSyncInferRequest(const std::shared_ptr<const LlamaCppModel>& compiled_model);
     virtual ~LlamaCppSyncInferRequest() override;
 
     virtual void set_tensors_impl(const ov::Output<const ov::Node> port,
@@ -23,8 +29,122 @@ public:
     virtual std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
 
 private:
+    // the inputs and the output buffers of a single infer() call; the buffers of the disabled outputs are null
+    struct InferTask {
+        const int64_t* input_ids = nullptr;
+        const int64_t* position_ids = nullptr;
+        size_t batch_size = 0;
+        size_t sequence_length = 0;
+        float* logits = nullptr;
+        int64_t* greedy_token_ids = nullptr;
+        int64_t* top_k_token_ids = nullptr;
+        float* top_k_probs = nullptr;
+        int64_t* sampled_token_ids = nullptr;
+        float* hidden_states = nullptr;  // embeddings mode without pooling
+        float* embeddings = nullptr;     // embeddings mode with pooling
+        size_t n_output_tokens = 0;  // per sequence, counted from the end of the sequence
+        int64_t position_offset = 0;  // by which the KV cache contents were shifted back due to the context overflow
+        const int64_t* attention_mask = nullptr;  // null if there is no padding in the input
+        size_t attention_mask_length = 0;
+
+        llama_pos get_position(size_t idx) const {
+            return static_cast<llama_pos>(position_ids[idx] - position_offset);
+        }
+
+        bool is_padding(size_t idx) const {
+            if (attention_mask == nullptr) {
+                return false;
+            }
+            const size_t seq_idx = idx / sequence_length;
+            const size_t tok_idx = idx % sequence_length;
+            return attention_mask[(seq_idx + 1) * attention_mask_length - sequence_length + tok_idx] == 0;
+        }
+    };
+
+    ov::SoPtr<ov::ITensor> allocate_output(const ov::Output<const ov::Node>& port,
+                                           const ov::element::Type& element_type,
+                                           const ov::Shape& shape);
+    void reserve_batch(size_t n_tokens);
+    void reorder_kv_cache(const ov::SoPtr<ov::ITensor>& beam_idx_tensor_ptr, size_t batch_size);
+
+    // processes the tokens in the [begin, end) range of the flattened [batch, sequence] input in a single llama.cpp
+    // batch and writes out their logits, if requested
+    void decode(const InferTask& task, size_t begin, size_t end);
+    // copies the computed logits rows to the logits output and/or fills the sampling outputs from them
+    void extract_logits(const InferTask& task, size_t begin, size_t end, int32_t batch_offset);
+    // the output rows of the padding tokens are filled with zeros
+    void fill_padding_outputs(const InferTask& task, size_t output_row);
+    // copies or pools the final hidden state of a token in the embeddings mode
+    void extract_embeddings(const InferTask& task, size_t seq_idx, size_t output_row, int32_t batch_pos);
+
+    // same as `decode`, but splits the range into chunks of at most LLAMA_CPP_PREFILL_CHUNK_SIZE tokens
+    void decode_chunked(const InferTask& task, size_t begin, size_t end);
+    size_t get_chunk_size(llama_context* ctx) const;
+
+    // processes the [begin, sequence_length) input range of a single sequence with the main model, along with the
+    // tokens proposed by the draft model for its continuation; only the accepted tokens are kept in the KV caches of
+    // both models, and are written to the speculative_token_ids output along with the next token of the main model
+    void decode_speculatively(const InferTask& task, size_t begin);
+    void propose_draft_tokens(const InferTask& task);
+
+    // runs `fn` with exclusive access to the llama.cpp context, which may be shared with other infer requests
+    void run_on_context(const std::function<void(llama_context*)>& fn) const;
+
+    // makes room in the KV cache for the tokens of the task by removing the older tokens after the first
+    // LLAMA_CPP_CONTEXT_SHIFT_SINK_TOKENS ones and shifting the rest back, if the context shift is enabled
+    void shift_context(const InferTask& task);
+
+    // returns the number of prompt tokens which were restored from (or stored in) the compiled model's prefix cache;
+    // only applies to single-sequence inputs, for which the token index is the same as the flattened index
+    size_t apply_prefix_cache(const InferTask& task);
+
     std::shared_ptr<const LlamaCppModel> m_compiled_model_ptr;
     llama_context* m_llama_ctx;
+
+    // set if the llama.cpp context is shared with the other infer requests of the compiled model, in which case the
+    // request's sequences start at m_first_seq_id
+    LlamaCppScheduler* m_scheduler = nullptr;
+    llama_seq_id m_first_seq_id = 0;
+
+    // set otherwise, the CPUs of the partition are used for the request's own llama.cpp context
+    CpuPartitioner* m_cpu_partitioner = nullptr;
+    size_t m_cpu_partition_idx = 0;
+
+    llama_batch m_batch = {};
+    size_t m_batch_capacity = 0;
+
+    // also updated by set_state() of the variable state returned by query_state()
+    mutable SequenceInfo m_sequence_info;
+
+    LogitsSampler m_sampler;
+
+    // context of the draft model and its proposals in the last inference, only set for the speculative decoding
+    llama_context* m_draft_llama_ctx = nullptr;
+    std::vector<llama_token> m_draft_tokens;
+
+    // number of the tokens pooled into the embeddings of each sequence in the current inference
+    std::vector<size_t> m_num_pooled_tokens;
+
+    // timings of the stages of the last infer() call, reported by get_profiling_info(); whether a stage has run is
+    // recorded separately, since the short stages may take less than the reported time resolution
+    struct StageStats {
+        std::chrono::nanoseconds time{0};
+        bool executed = false;
+
+        void add(std::chrono::nanoseconds duration) {
+            time += duration;
+            executed = true;
+        }
+    };
+    struct ProfilingStats {
+        StageStats batch_building;
+        StageStats prompt_eval;
+        StageStats token_eval;
+        StageStats logits_extraction;
+        size_t n_prompt_tokens = 0;
+        size_t n_eval_tokens = 0;
+    };
+    ProfilingStats m_profiling_stats;
 };
 
 }  // namespace llama_cpp_plugin
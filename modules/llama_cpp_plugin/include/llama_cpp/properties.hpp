@@ -0,0 +1,165 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for properties specific to the LLAMA_CPP plugin
+ *        To use in set_property, compile_model, import_model, get_property methods
+ *
+ * @file llama_cpp/properties.hpp
+ */
+#pragma once
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+
+/**
+ * @brief Namespace with LLAMA_CPP plugin specific properties
+ */
+namespace llama_cpp {
+
+/**
+ * @brief Makes the plugin output the logits only for the last token of each sequence in the batch, in which case the
+ * `logits` output has the shape [batch, 1, vocab] instead of [batch, seq, vocab]. Useful for generation, which only
+ * needs the distribution for the next token. Only the copy of the logits is saved: the llama.cpp version used by the
+ * plugin computes the output projection for all the tokens of a batch regardless.
+ */
+static constexpr Property<bool, PropertyMutability::RW> logits_last_token_only{"LLAMA_CPP_LOGITS_LAST_TOKEN_ONLY"};
+
+/**
+ * @brief Maximum number of prompt prefixes for which the KV cache state is kept by the compiled model, so that the
+ * infer requests starting with a previously seen prefix (e.g. a common system prompt) only have to process the rest of
+ * the prompt. The cached prefixes are detected automatically. 0 disables the prefix cache. The prefix cache is only
+ * used with `logits_last_token_only` enabled and for single-sequence prompts.
+ */
+static constexpr Property<size_t, PropertyMutability::RW> prefix_cache_size{"LLAMA_CPP_PREFIX_CACHE_SIZE"};
+
+/**
+ * @brief Minimum length (in tokens) of a common prompt prefix to be stored in the prefix cache
+ */
+static constexpr Property<size_t, PropertyMutability::RW> prefix_cache_min_tokens{"LLAMA_CPP_PREFIX_CACHE_MIN_TOKENS"};
+
+/**
+ * @brief Makes all infer requests of a compiled model share a single llama.cpp context (and KV cache), with each infer
+ * request using its own set of llama.cpp sequence IDs. The decode steps submitted concurrently by different infer
+ * requests are merged into a single `llama_decode` call, which improves the throughput under concurrency and caps the
+ * memory consumption at one KV cache. The prefix cache is not used in this mode.
+ */
+static constexpr Property<bool, PropertyMutability::RW> continuous_batching{"LLAMA_CPP_CONTINUOUS_BATCHING"};
+
+/**
+ * @brief Size of the llama.cpp context (i.e. the KV cache capacity) in tokens. 0 means the model's training context
+ * size, which may be very large (e.g. 128k tokens) and determines the memory footprint of each context.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> context_size{"LLAMA_CPP_CONTEXT_SIZE"};
+
+/**
+ * @brief Maximum number of tokens submitted in a single `llama_decode` call (the logical batch size). 0 means the
+ * llama.cpp default.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> batch_size{"LLAMA_CPP_BATCH_SIZE"};
+
+/**
+ * @brief Maximum number of tokens processed by llama.cpp in a single compute graph run (the physical batch size),
+ * which determines the size of the activation buffers. 0 means the llama.cpp default.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> micro_batch_size{"LLAMA_CPP_MICRO_BATCH_SIZE"};
+
+/**
+ * @brief Data type of the keys and values stored in the KV cache - one of "f32", "f16", "q8_0" or "q4_0".
+ */
+static constexpr Property<std::string, PropertyMutability::RW> kv_cache_type{"LLAMA_CPP_KV_CACHE_TYPE"};
+
+/**
+ * @brief Maximum number of tokens submitted to llama.cpp at once when processing long inputs (e.g. prompts). Longer
+ * inputs are split into chunks which are decoded one after another, so that the peak memory consumption does not depend
+ * on the prompt length. 0 means the llama.cpp batch size of the context (see `batch_size`), which also limits the
+ * larger values.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> prefill_chunk_size{"LLAMA_CPP_PREFILL_CHUNK_SIZE"};
+
+/**
+ * @brief Whether the compiled model has the `logits` output. Disabling it together with enabling one of the sampling
+ * outputs below saves the copying of the full vocabulary-sized logits rows for each generated token.
+ */
+static constexpr Property<bool, PropertyMutability::RW> logits_output{"LLAMA_CPP_LOGITS_OUTPUT"};
+
+/**
+ * @brief Adds the `greedy_token_ids` output of shape [batch, tokens] with the index of the largest logit for each of
+ * the tokens for which the logits are computed.
+ */
+static constexpr Property<bool, PropertyMutability::RW> greedy_output{"LLAMA_CPP_GREEDY_OUTPUT"};
+
+/**
+ * @brief If non-zero, adds the `top_k_token_ids` and `top_k_probs` outputs of shape [batch, tokens, k] with the k most
+ * probable token IDs and their softmax probabilities in the descending order of probability.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> top_k_output{"LLAMA_CPP_TOP_K_OUTPUT"};
+
+/**
+ * @brief If positive, adds the `sampled_token_ids` output of shape [batch, tokens] with the token IDs sampled from the
+ * softmax of the logits divided by this temperature, restricted to the `sampling_top_p` nucleus.
+ */
+static constexpr Property<float, PropertyMutability::RW> sampling_temperature{"LLAMA_CPP_SAMPLING_TEMPERATURE"};
+
+/**
+ * @brief Cumulative probability of the most probable tokens (the nucleus) to which the sampling is restricted; 1.0
+ * means sampling from the whole vocabulary.
+ */
+static constexpr Property<float, PropertyMutability::RW> sampling_top_p{"LLAMA_CPP_SAMPLING_TOP_P"};
+
+/**
+ * @brief Seed of the random number generator used for the sampling. Each infer request has its own generator
+ * initialized with this seed.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> sampling_seed{"LLAMA_CPP_SAMPLING_SEED"};
+
+/**
+ * @brief Path to the GGUF file of a smaller draft model with the same vocabulary as the main model. If set, each
+ * inference of a single sequence generates `num_draft_tokens` tokens with the draft model and verifies them with the
+ * main model in a single batch; the accepted tokens are returned in the `speculative_token_ids` output.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> draft_model{"LLAMA_CPP_DRAFT_MODEL"};
+
+/**
+ * @brief Number of tokens generated by the draft model for each verification by the main model.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> num_draft_tokens{"LLAMA_CPP_NUM_DRAFT_TOKENS"};
+
+/**
+ * @brief Whether the infer request shifts its KV cache instead of failing when the processed tokens no longer fit into
+ * the context. The shift keeps the first `context_shift_sink_tokens` tokens and discards the older half of the rest,
+ * moving the newer half back; the position_ids of the subsequent inputs keep counting from where they were.
+ */
+static constexpr Property<bool, PropertyMutability::RW> context_shift{"LLAMA_CPP_CONTEXT_SHIFT"};
+
+/**
+ * @brief Number of tokens at the beginning of each sequence (e.g. the system prompt or the attention sink) which are
+ * never discarded by the context shift.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> context_shift_sink_tokens{
+    "LLAMA_CPP_CONTEXT_SHIFT_SINK_TOKENS"};
+
+/**
+ * @brief Switches the compiled model into the embeddings mode, in which the only output holds the final hidden states
+ * of the model instead of the logits: either `last_hidden_state` of shape [batch, tokens, hidden size] or, depending
+ * on `pooling_type`, the pooled `embeddings` of shape [batch, hidden size].
+ */
+static constexpr Property<bool, PropertyMutability::RW> embeddings{"LLAMA_CPP_EMBEDDINGS"};
+
+/**
+ * @brief Pooling of the hidden states of the input tokens in the embeddings mode - one of "none" (no pooling, the
+ * `last_hidden_state` output), "mean", "cls" (the first token) or "last" (the last token).
+ */
+static constexpr Property<std::string, PropertyMutability::RW> pooling_type{"LLAMA_CPP_POOLING_TYPE"};
+
+/**
+ * @brief Type of the matrix weights in the GGUF file produced when an OpenVINO IR is compiled on the device - one of
+ * "f32", "f16" or "q8_0". The norm weights are always kept in f32.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> conversion_weights_type{
+    "LLAMA_CPP_CONVERSION_WEIGHTS_TYPE"};
+
+}  // namespace llama_cpp
+}  // namespace ov
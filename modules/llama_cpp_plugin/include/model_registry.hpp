@@ -0,0 +1,27 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LLAMA_CPP_MODEL_REGISTRY_HPP
+#define LLAMA_CPP_MODEL_REGISTRY_HPP
+
+#include <memory>
+#include <string>
+
+#include "llama.h"
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+/**
+ * @brief Returns a llama.cpp model loaded from the GGUF file with the given parameters. The loaded models are kept in a
+ * process-wide registry, so that the compiled models created for the same GGUF file and loading parameters share a
+ * single (memory-mapped) set of weights. The model is freed once the last reference to it is released.
+ *
+ * The llama.cpp backend is initialized before the first model is loaded and freed after the last model is released.
+ */
+std::shared_ptr<llama_model> acquire_llama_model(const std::string& gguf_fname, const llama_model_params& mparams);
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
+
+#endif  // LLAMA_CPP_MODEL_REGISTRY_HPP
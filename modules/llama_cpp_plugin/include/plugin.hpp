@@ -4,6 +4,7 @@
 #ifndef LLAMA_CPP_PLUGIN_HPP
 #define LLAMA_CPP_PLUGIN_HPP
 
+#include "config.hpp"
 #include "openvino/runtime/iplugin.hpp"
 
 namespace ov {
@@ -41,7 +42,10 @@ public:
                                             const ov::AnyMap& properties) const override;
 
 private:
-    size_t m_num_threads = 0;
+    // resolves the AUTO and NUMA values of ov::num_streams in the config and creates the executor for its streams
+    std::shared_ptr<ov::threading::ITaskExecutor> create_task_executor(Config& config) const;
+
+    Config m_config;
 };
 }  // namespace llama_cpp_plugin
 }  // namespace ov
@@ -0,0 +1,71 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LLAMA_CPP_PREFIX_CACHE_HPP
+#define LLAMA_CPP_PREFIX_CACHE_HPP
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "llama.h"
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+/**
+ * @brief Stores the llama.cpp context state (i.e. the KV cache contents) after processing common prompt prefixes, so
+ * that the infer requests of the same compiled model starting from such a prefix can restore the state instead of
+ * recomputing it. The entries are identified by the hash of the prefix token sequence and evicted in the LRU order.
+ *
+ * The prefixes worth caching are detected automatically as the longest common prefixes between the prompts that the
+ * cache has recently seen.
+ */
+class PrefixCache {
+public:
+    PrefixCache(size_t capacity, size_t min_prefix_length);
+
+    /**
+     * @brief Restores the state for the longest cached prefix of the given prompt into an (empty) llama.cpp context.
+     *
+     * @return Length of the restored prefix, 0 if no cached prefix was found. At least one token of the prompt is
+     * always left to be processed.
+     */
+    size_t restore(llama_context* ctx, const int64_t* tokens, size_t n_tokens);
+
+    /**
+     * @brief Records the prompt as seen and returns the length of the prefix it shares with the previously seen
+     * prompts, if that prefix should be processed separately and stored with `store`; 0 otherwise.
+     */
+    size_t get_prefix_length_to_store(const int64_t* tokens, size_t n_tokens);
+
+    /**
+     * @brief Saves the state of the llama.cpp context which has processed exactly the given prefix tokens.
+     */
+    void store(llama_context* ctx, const int64_t* tokens, size_t n_tokens);
+
+private:
+    struct Entry {
+        uint64_t hash;
+        std::vector<int64_t> tokens;
+        std::vector<uint8_t> state;
+    };
+
+    size_t m_capacity;
+    size_t m_min_prefix_length;
+
+    std::mutex m_mutex;
+    std::list<Entry> m_entries;  // most recently used first
+    std::list<std::vector<int64_t>> m_seen_prompts;
+
+    std::mutex m_scratch_mutex;
+    std::unique_ptr<uint8_t[]> m_scratch;
+    size_t m_scratch_size = 0;
+};
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
+
+#endif  // LLAMA_CPP_PREFIX_CACHE_HPP
@@ -0,0 +1,52 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LLAMA_CPP_SAMPLER_HPP
+#define LLAMA_CPP_SAMPLER_HPP
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+/**
+ * @brief Selects tokens directly from the logits rows computed by llama.cpp, so that the applications which only need
+ * the next token do not have to receive and scan the full vocabulary-sized logits.
+ */
+class LogitsSampler {
+public:
+    LogitsSampler(float temperature, float top_p, uint32_t seed);
+
+    /**
+     * @brief Returns the index of the largest logit.
+     */
+    static int64_t get_greedy_token(const float* logits, size_t n_vocab);
+
+    /**
+     * @brief Writes the k most probable token IDs and their softmax probabilities (over the whole vocabulary) into
+     * `token_ids` and `probs` in the descending order of probability.
+     */
+    void get_top_k_tokens(const float* logits, size_t n_vocab, size_t k, int64_t* token_ids, float* probs);
+
+    /**
+     * @brief Samples a token from the softmax of the logits scaled by the temperature, restricted to the smallest set
+     * of the most probable tokens with the cumulative probability of at least top_p.
+     */
+    int64_t sample_token(const float* logits, size_t n_vocab);
+
+private:
+    float m_temperature;
+    float m_top_p;
+    std::mt19937 m_generator;
+
+    // (probability or logit, token ID) pairs; kept between the calls to avoid the vocabulary-sized allocations
+    std::vector<std::pair<float, int32_t>> m_candidates;
+};
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
+
+#endif /* LLAMA_CPP_SAMPLER_HPP */
@@ -0,0 +1,101 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LLAMA_CPP_SCHEDULER_HPP
+#define LLAMA_CPP_SCHEDULER_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "llama.h"
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+/**
+ * @brief Multiplexes the infer requests of a compiled model onto a single llama.cpp context. Each infer request gets
+ * its own range of llama.cpp sequence IDs in the shared KV cache, and the decode steps submitted concurrently by
+ * different infer requests are merged into a single `llama_decode` call.
+ *
+ * No dedicated scheduling thread is used - the first thread to submit a decode step while the context is idle becomes
+ * the "leader" and decodes all the steps pending at that moment on behalf of the other threads, which wait for the
+ * results.
+ */
+class LlamaCppScheduler {
+public:
+    // maximum number of sequences per infer request, half of which are reserved as scratch for the beam reordering
+    static constexpr llama_seq_id SEQUENCES_PER_REQUEST = 64;
+
+    LlamaCppScheduler(llama_model* model, const llama_context_params& cparams);
+    ~LlamaCppScheduler();
+
+    llama_context* get_context() const {
+        return m_llama_ctx;
+    }
+
+    /**
+     * @brief Reserves a range of SEQUENCES_PER_REQUEST sequence IDs for an infer request
+     *
+     * @return First sequence ID of the range
+     */
+    llama_seq_id acquire_sequences();
+
+    /**
+     * @brief Returns the range of sequence IDs to the scheduler and removes the corresponding KV cache contents
+     */
+    void release_sequences(llama_seq_id first_seq_id);
+
+    /**
+     * @brief Removes the KV cache contents for the range of sequence IDs
+     */
+    void clear_sequences(llama_seq_id first_seq_id);
+
+    /**
+     * @brief Decodes the batch, possibly together with the batches submitted concurrently by other infer requests.
+     *
+     * @param batch Tokens to decode
+     * @param on_decoded Called after a successful decode, while the logits for the batch are still available, with the
+     * index of the first token of `batch` in the merged batch (i.e. the offset for the `llama_get_logits_ith` calls).
+     * May be called on a different thread.
+     */
+    void decode(const llama_batch& batch, const std::function<void(int32_t)>& on_decoded);
+
+    /**
+     * @brief Runs `fn` with exclusive access to the shared context, e.g. to manipulate the KV cache.
+     */
+    void run_exclusive(const std::function<void(llama_context*)>& fn);
+
+private:
+    struct Job {
+        const llama_batch* batch;
+        const std::function<void(int32_t)>* on_decoded;
+        int32_t status = 0;
+        std::exception_ptr exception;
+        bool done = false;
+    };
+
+    void reserve_merged_batch(size_t n_tokens);
+    void run_jobs(const std::vector<Job*>& jobs);
+
+    llama_context* m_llama_ctx = nullptr;
+    size_t m_max_batch_tokens;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_is_busy = false;
+    std::vector<Job*> m_pending_jobs;
+    std::vector<Job*> m_running_jobs;
+    std::vector<llama_seq_id> m_free_sequence_ranges;
+    llama_seq_id m_next_sequence_range = 0;
+
+    llama_batch m_merged_batch = {};
+    size_t m_merged_batch_capacity = 0;
+};
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
+
+#endif  // LLAMA_CPP_SCHEDULER_HPP
@@ -1,27 +1,55 @@
 // Copyright (C) 2018-2023 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
-#ifndef LLAMA_CPP_PLUGIN_HPP
-#define LLAMA_CPP_PLUGIN_HPP
+#ifndef LLAMA_CPP_STATE_HPP
+#define LLAMA_CPP_STATE_HPP
 
 #include "compiled_model.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
+#include "scheduler.hpp"
 
 namespace ov {
 namespace llama_cpp_plugin {
+// The part of the sequence state which is tracked by the infer request rather than by the llama.cpp context
+struct SequenceInfo {
+    // number of sequences (i.e. the batch size) of the previous inference, which beam_idx values refer to
+    size_t num_sequences = 0;
+    // accumulated shift of the KV cache positions relative to the input position_ids
+    int64_t position_offset = 0;
+};
+
 class LlamaCppState : public IVariableState {
 public:
     LlamaCppState() = delete;
-    LlamaCppState(llama_context* llama_context_ptr)
-        : m_llama_ctx_ptr(llama_context_ptr),
-          IVariableState("llama_cpp_state") {}
-    void reset() override {
-        OPENVINO_ASSERT(m_llama_ctx_ptr != nullptr);
-        llama_kv_cache_clear(m_llama_ctx_ptr);
-    }
+    LlamaCppState(llama_context* llama_context_ptr,
+                  LlamaCppScheduler* scheduler = nullptr,
+                  llama_seq_id first_seq_id = 0,
+                  llama_context* draft_llama_context_ptr = nullptr,
+                  SequenceInfo* sequence_info = nullptr)
+        : IVariableState("llama_cpp_state"),
+          m_llama_ctx_ptr(llama_context_ptr),
+          m_scheduler(scheduler),
+          m_first_seq_id(first_seq_id),
+          m_draft_llama_ctx_ptr(draft_llama_context_ptr),
+          m_sequence_info(sequence_info) {}
+    void reset() override;
+
+    /**
+     * @brief Serializes the llama.cpp context state (the KV cache contents along with the last computed logits) into
+     * a u8 tensor, which may be stored and later passed to `set_state` of an infer request of a compiled model with
+     * the same GGUF file and context properties. The number of sequences and the position offset of the infer request
+     * are saved as well. Not supported with continuous batching.
+     */
+    const ov::SoPtr<ov::ITensor>& get_state() const override;
+    void set_state(const ov::SoPtr<ov::ITensor>& state) override;
 
 private:
     llama_context* m_llama_ctx_ptr;
+    LlamaCppScheduler* m_scheduler;
+    llama_seq_id m_first_seq_id;
+    llama_context* m_draft_llama_ctx_ptr;  // only set for the speculative decoding
+    SequenceInfo* m_sequence_info;         // saved and restored along with the llama.cpp context state
+    mutable ov::SoPtr<ov::ITensor> m_serialized_state;
 };
 }  // namespace llama_cpp_plugin
 }  // namespace ov
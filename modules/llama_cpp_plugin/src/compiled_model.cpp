@@ -3,60 +3,145 @@
 
 #include "compiled_model.hpp"
 
-#include <fstream>
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <thread>
+#include <utility>
 #include <openvino/op/constant.hpp>
 #include <openvino/opsets/opset13.hpp>
 #include <openvino/runtime/properties.hpp>
 #include <openvino/util/log.hpp>
 
+#include "gguf_manifest.hpp"
 #include "infer_request.hpp"
+#include "model_registry.hpp"
 #include "plugin.hpp"
 
 namespace ov {
 namespace llama_cpp_plugin {
 
+namespace {
+ggml_type get_ggml_type(const std::string& type_name) {
+    static const std::map<std::string, ggml_type> ggml_types = {{"f32", GGML_TYPE_F32},
+                                                                {"f16", GGML_TYPE_F16},
+                                                                {"q8_0", GGML_TYPE_Q8_0},
+                                                                {"q4_0", GGML_TYPE_Q4_0}};
+    auto it = ggml_types.find(type_name);
+    OPENVINO_ASSERT(it != ggml_types.end(), "llama_cpp_plugin: unsupported KV cache type ", type_name);
+    return it->second;
+}
+}  // namespace
+
 LlamaCppModel::~LlamaCppModel() {
-    llama_free_model(m_llama_model_ptr);
-    llama_backend_free();
+    m_scheduler.reset();  // the shared context must be freed before the model
+}
+
+LlamaCppModel::LlamaCppModel(const std::shared_ptr<TemporaryGgufFile>& gguf_file,
+                             const std::shared_ptr<const IPlugin>& plugin,
+                             const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
+                             const Config& config)
+    : LlamaCppModel(gguf_file->get_path(), plugin, task_executor, config) {
+    m_gguf_file = gguf_file;
 }
 
 LlamaCppModel::LlamaCppModel(const std::string& gguf_fname,
                              const std::shared_ptr<const IPlugin>& plugin,
-                             size_t num_threads)
-    : ICompiledModel(nullptr, plugin),
+                             const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
+                             const Config& config)
+    : ICompiledModel(nullptr, plugin, task_executor),
       m_gguf_fname(gguf_fname),
-      m_num_threads(num_threads) {
+      m_config(config) {
     OPENVINO_DEBUG("llama_cpp_plugin: loading llama model directly from GGUF... \n");
     llama_model_params mparams = llama_model_default_params();
     mparams.n_gpu_layers = 99;
-    m_llama_model_ptr = llama_load_model_from_file(gguf_fname.c_str(), mparams);
+    mparams.use_mmap = true;  // also makes the import from the model cache near-instant
+    m_llama_model = acquire_llama_model(gguf_fname, mparams);
+    m_llama_model_ptr = m_llama_model.get();
     OPENVINO_DEBUG("llama_cpp_plugin: llama model loaded successfully from GGUF... \n");
 
+    OPENVINO_ASSERT(!m_config.context_shift || !m_config.continuous_batching,
+                    "llama_cpp_plugin: context shift cannot be combined with continuous batching");
+    if (!m_config.draft_model.empty()) {
+        OPENVINO_ASSERT(!m_config.continuous_batching,
+                        "llama_cpp_plugin: speculative decoding cannot be combined with continuous batching");
+        m_draft_llama_model = acquire_llama_model(m_config.draft_model, mparams);
+        OPENVINO_ASSERT(llama_n_vocab(m_draft_llama_model.get()) == llama_n_vocab(m_llama_model_ptr),
+                        "llama_cpp_plugin: the vocabulary of the draft model ",
+                        m_config.draft_model,
+                        " does not match that of the main model");
+    }
+
+    if (m_config.prefix_cache_size != 0) {
+        m_prefix_cache.reset(new PrefixCache(m_config.prefix_cache_size, m_config.prefix_cache_min_tokens));
+    }
+    if (m_config.continuous_batching) {
+        m_scheduler.reset(new LlamaCppScheduler(m_llama_model_ptr, get_context_params()));
+    } else {
+        m_cpu_partitioner.reset(new CpuPartitioner(std::max(m_config.num_streams, 1)));
+    }
+
+    OPENVINO_ASSERT(m_config.top_k_output <= static_cast<uint32_t>(llama_n_vocab(m_llama_model_ptr)),
+                    "llama_cpp_plugin: top-k output size ",
+                    m_config.top_k_output,
+                    " exceeds the vocabulary size");
+
     auto input_ids = std::make_shared<ov::opset13::Parameter>(ov::element::Type_t::i64, ov::PartialShape({-1, -1}));
-    auto fake_convert = std::make_shared<ov::opset13::Convert>(input_ids->output(0), ov::element::Type_t::f32);
-    auto logits = std::make_shared<ov::opset13::Result>(fake_convert->output(0));
 
     ov::ParameterVector inputs{input_ids};
 
     std::vector<std::tuple<std::string, ov::element::Type_t, ov::PartialShape>> additional_inputs_in_order = {
         {"attention_mask", ov::element::Type_t::i64, {-1, -1}},
         {"position_ids", ov::element::Type_t::i64, {-1, -1}},
-        {"beam_idx", ov::element::Type_t::i32, {-1, -1}}};
+        {"beam_idx", ov::element::Type_t::i32, {-1}}};
 
     for (const auto& descr : additional_inputs_in_order) {
         auto unused_inp = std::make_shared<ov::opset13::Parameter>(std::get<1>(descr), std::get<2>(descr));
         inputs.push_back(unused_inp);
     }
 
-    m_fake_model = std::make_shared<ov::Model>(logits, inputs, "fake_ov_model_for_io_specification");
+    std::vector<std::pair<std::string, ov::element::Type_t>> outputs_in_order;
+    if (m_config.embeddings) {
+        bool has_generation_outputs = m_config.greedy_output || m_config.top_k_output != 0 ||
+                                      m_config.sampling_temperature > 0.0f || m_draft_llama_model;
+        OPENVINO_ASSERT(!has_generation_outputs,
+                        "llama_cpp_plugin: the embeddings mode cannot be combined with the token generation outputs");
+        outputs_in_order.emplace_back(m_config.pooling_type == "none" ? "last_hidden_state" : "embeddings",
+                                      ov::element::Type_t::f32);
+    } else if (m_config.logits_output) {
+        outputs_in_order.emplace_back("logits", ov::element::Type_t::f32);
+    }
+    if (m_config.greedy_output) {
+        outputs_in_order.emplace_back("greedy_token_ids", ov::element::Type_t::i64);
+    }
+    if (m_config.top_k_output != 0) {
+        outputs_in_order.emplace_back("top_k_token_ids", ov::element::Type_t::i64);
+        outputs_in_order.emplace_back("top_k_probs", ov::element::Type_t::f32);
+    }
+    if (m_config.sampling_temperature > 0.0f) {
+        outputs_in_order.emplace_back("sampled_token_ids", ov::element::Type_t::i64);
+    }
+    if (m_draft_llama_model) {
+        outputs_in_order.emplace_back("speculative_token_ids", ov::element::Type_t::i64);
+    }
+    OPENVINO_ASSERT(!outputs_in_order.empty(), "llama_cpp_plugin: the logits output is disabled, but no other is set");
+
+    ov::ResultVector results;
+    for (const auto& descr : outputs_in_order) {
+        auto fake_convert = std::make_shared<ov::opset13::Convert>(input_ids->output(0), descr.second);
+        results.push_back(std::make_shared<ov::opset13::Result>(fake_convert->output(0)));
+    }
+
+    m_fake_model = std::make_shared<ov::Model>(results, inputs, "fake_ov_model_for_io_specification");
 
     m_fake_model->inputs()[0].set_names({"input_ids"});
     for (size_t i = 0; i < additional_inputs_in_order.size(); i++) {
         m_fake_model->inputs()[i + 1].set_names({std::get<0>(additional_inputs_in_order[i])});
     }
 
-    m_fake_model->outputs()[0].set_names({"logits"});
+    for (size_t i = 0; i < outputs_in_order.size(); i++) {
+        m_fake_model->outputs()[i].set_names({outputs_in_order[i].first});
+    }
 
     for (auto input : m_fake_model->inputs()) {
         m_fake_inputs.emplace_back(input);
@@ -66,6 +151,25 @@ LlamaCppModel::LlamaCppModel(const std::string& gguf_fname,
     }
 }
 
+llama_context_params LlamaCppModel::get_context_params() const {
+    llama_context_params cparams = llama_context_default_params();
+    cparams.n_threads = m_config.num_threads ? m_config.num_threads : std::thread::hardware_concurrency();
+    // 0 means that the actual n_ctx will be taken equal to the model's train-time value
+    cparams.n_ctx = m_config.context_size;
+    if (m_config.batch_size != 0) {
+        cparams.n_batch = m_config.batch_size;
+    }
+    if (m_config.micro_batch_size != 0) {
+        cparams.n_ubatch = m_config.micro_batch_size;
+    }
+    cparams.type_k = get_ggml_type(m_config.kv_cache_type);
+    cparams.type_v = cparams.type_k;
+    // the pooling is done by the plugin itself, so that it is the same for all architectures and across the chunks
+    cparams.embeddings = m_config.embeddings;
+    cparams.pooling_type = LLAMA_POOLING_TYPE_NONE;
+    return cparams;
+}
+
 std::shared_ptr<const ov::Model> LlamaCppModel::get_runtime_model() const {
     OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: Not Implemented");
 }
@@ -76,14 +180,23 @@ void LlamaCppModel::set_property(const ov::AnyMap& properties) {
 
 ov::Any LlamaCppModel::get_property(const std::string& name) const {
     if (ov::supported_properties == name) {
-        return decltype(ov::supported_properties)::value_type(std::vector<PropertyName>());
+        // the configuration is fixed at the compile time, see set_property
+        std::vector<ov::PropertyName> supported_properties;
+        for (const auto& property : Config::get_supported_properties()) {
+            supported_properties.emplace_back(property, ov::PropertyMutability::RO);
+        }
+        supported_properties.emplace_back(ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO);
+        return decltype(ov::supported_properties)::value_type(supported_properties);
     }
-    OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: Not Implemented");
+    if (ov::optimal_number_of_infer_requests == name) {
+        return static_cast<uint32_t>(std::max(m_config.num_streams, 1));
+    }
+    return m_config.get_property(name);
 }
 
 std::shared_ptr<ov::ISyncInferRequest> LlamaCppModel::create_sync_infer_request() const {
-    return std::make_shared<LlamaCppSyncInferRequest>(std::static_pointer_cast<const LlamaCppModel>(shared_from_this()),
-                                                      m_num_threads);
+    return std::make_shared<LlamaCppSyncInferRequest>(
+        std::static_pointer_cast<const LlamaCppModel>(shared_from_this()));
 }
 
 const std::vector<ov::Output<const ov::Node>>& LlamaCppModel::inputs() const {
@@ -94,8 +207,14 @@ const std::vector<ov::Output<const ov::Node>>& LlamaCppModel::outputs() const {
 };
 
 void LlamaCppModel::export_model(std::ostream& output_stream) const {
-    std::ifstream in(m_gguf_fname, std::ios::binary);
-    output_stream << in.rdbuf();
+    if (m_gguf_file) {
+        // the GGUF file produced by the plugin is removed along with the compiled model, so it has to be embedded
+        write_embedded_gguf(m_gguf_fname, output_stream);
+        return;
+    }
+    // Only a manifest referring to the GGUF file is stored, so that the weights are not duplicated on disk; the import
+    // then maps the original file into memory again.
+    GgufManifest::from_file(m_gguf_fname).write(output_stream);
 }
 
 }  // namespace llama_cpp_plugin
@@ -0,0 +1,213 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config.hpp"
+
+#include "llama_cpp/properties.hpp"
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+Config::Config(const ov::AnyMap& properties, const Config& defaults, bool throw_on_unsupported) : Config(defaults) {
+    set_property(properties, throw_on_unsupported);
+}
+
+void Config::set_property(const ov::AnyMap& properties, bool throw_on_unsupported) {
+    for (const auto& map_entry : properties) {
+        const std::string& key = map_entry.first;
+        const ov::Any& value = map_entry.second;
+        if (ov::inference_num_threads == key) {
+            int value_as_int = value.as<int>();
+            OPENVINO_ASSERT(value_as_int >= 0, "INFERENCE_NUM_THREADS cannot be negative");
+            num_threads = value_as_int;
+        } else if (ov::llama_cpp::logits_last_token_only == key) {
+            logits_last_token_only = value.as<bool>();
+        } else if (ov::llama_cpp::prefix_cache_size == key) {
+            prefix_cache_size = value.as<size_t>();
+        } else if (ov::llama_cpp::prefix_cache_min_tokens == key) {
+            prefix_cache_min_tokens = value.as<size_t>();
+        } else if (ov::llama_cpp::continuous_batching == key) {
+            continuous_batching = value.as<bool>();
+        } else if (ov::llama_cpp::context_size == key) {
+            context_size = value.as<uint32_t>();
+        } else if (ov::llama_cpp::batch_size == key) {
+            batch_size = value.as<uint32_t>();
+        } else if (ov::llama_cpp::micro_batch_size == key) {
+            micro_batch_size = value.as<uint32_t>();
+        } else if (ov::llama_cpp::kv_cache_type == key) {
+            std::string type = value.as<std::string>();
+            OPENVINO_ASSERT(type == "f32" || type == "f16" || type == "q8_0" || type == "q4_0",
+                            "llama_cpp_plugin: unsupported KV cache type ",
+                            type);
+            kv_cache_type = type;
+        } else if (ov::llama_cpp::prefill_chunk_size == key) {
+            prefill_chunk_size = value.as<uint32_t>();
+        } else if (ov::enable_profiling == key) {
+            enable_profiling = value.as<bool>();
+        } else if (ov::llama_cpp::logits_output == key) {
+            logits_output = value.as<bool>();
+        } else if (ov::llama_cpp::greedy_output == key) {
+            greedy_output = value.as<bool>();
+        } else if (ov::llama_cpp::top_k_output == key) {
+            top_k_output = value.as<uint32_t>();
+        } else if (ov::llama_cpp::sampling_temperature == key) {
+            float temperature = value.as<float>();
+            OPENVINO_ASSERT(temperature >= 0.0f, "llama_cpp_plugin: sampling temperature cannot be negative");
+            sampling_temperature = temperature;
+        } else if (ov::llama_cpp::sampling_top_p == key) {
+            float top_p = value.as<float>();
+            OPENVINO_ASSERT(top_p > 0.0f && top_p <= 1.0f, "llama_cpp_plugin: sampling top_p must be in (0, 1]");
+            sampling_top_p = top_p;
+        } else if (ov::llama_cpp::sampling_seed == key) {
+            sampling_seed = value.as<uint32_t>();
+        } else if (ov::llama_cpp::draft_model == key) {
+            draft_model = value.as<std::string>();
+        } else if (ov::llama_cpp::num_draft_tokens == key) {
+            uint32_t n_draft = value.as<uint32_t>();
+            OPENVINO_ASSERT(n_draft > 0, "llama_cpp_plugin: the number of draft tokens must be positive");
+            num_draft_tokens = n_draft;
+        } else if (ov::llama_cpp::context_shift == key) {
+            context_shift = value.as<bool>();
+        } else if (ov::llama_cpp::context_shift_sink_tokens == key) {
+            context_shift_sink_tokens = value.as<uint32_t>();
+        } else if (ov::llama_cpp::embeddings == key) {
+            embeddings = value.as<bool>();
+        } else if (ov::llama_cpp::pooling_type == key) {
+            std::string type = value.as<std::string>();
+            OPENVINO_ASSERT(type == "none" || type == "mean" || type == "cls" || type == "last",
+                            "llama_cpp_plugin: unsupported pooling type ",
+                            type);
+            pooling_type = type;
+        } else if (ov::num_streams == key) {
+            int32_t streams = value.as<ov::streams::Num>().num;
+            OPENVINO_ASSERT(streams > 0 || streams == ov::streams::AUTO.num || streams == ov::streams::NUMA.num,
+                            "llama_cpp_plugin: unsupported number of streams ",
+                            streams);
+            num_streams = streams;
+        } else if (ov::hint::enable_cpu_pinning == key) {
+            enable_cpu_pinning = value.as<bool>();
+        } else if (ov::llama_cpp::conversion_weights_type == key) {
+            std::string type = value.as<std::string>();
+            OPENVINO_ASSERT(type == "f32" || type == "f16" || type == "q8_0",
+                            "llama_cpp_plugin: unsupported conversion weights type ",
+                            type);
+            conversion_weights_type = type;
+        } else if (throw_on_unsupported) {
+            OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: setting property ", key, " not implemented");
+        }
+    }
+}
+
+ov::Any Config::get_property(const std::string& name) const {
+    if (ov::inference_num_threads == name) {
+        return static_cast<int32_t>(num_threads);
+    }
+    if (ov::llama_cpp::logits_last_token_only == name) {
+        return logits_last_token_only;
+    }
+    if (ov::llama_cpp::prefix_cache_size == name) {
+        return prefix_cache_size;
+    }
+    if (ov::llama_cpp::prefix_cache_min_tokens == name) {
+        return prefix_cache_min_tokens;
+    }
+    if (ov::llama_cpp::continuous_batching == name) {
+        return continuous_batching;
+    }
+    if (ov::llama_cpp::context_size == name) {
+        return context_size;
+    }
+    if (ov::llama_cpp::batch_size == name) {
+        return batch_size;
+    }
+    if (ov::llama_cpp::micro_batch_size == name) {
+        return micro_batch_size;
+    }
+    if (ov::llama_cpp::kv_cache_type == name) {
+        return kv_cache_type;
+    }
+    if (ov::llama_cpp::prefill_chunk_size == name) {
+        return prefill_chunk_size;
+    }
+    if (ov::enable_profiling == name) {
+        return enable_profiling;
+    }
+    if (ov::llama_cpp::logits_output == name) {
+        return logits_output;
+    }
+    if (ov::llama_cpp::greedy_output == name) {
+        return greedy_output;
+    }
+    if (ov::llama_cpp::top_k_output == name) {
+        return top_k_output;
+    }
+    if (ov::llama_cpp::sampling_temperature == name) {
+        return sampling_temperature;
+    }
+    if (ov::llama_cpp::sampling_top_p == name) {
+        return sampling_top_p;
+    }
+    if (ov::llama_cpp::sampling_seed == name) {
+        return sampling_seed;
+    }
+    if (ov::llama_cpp::draft_model == name) {
+        return draft_model;
+    }
+    if (ov::llama_cpp::num_draft_tokens == name) {
+        return num_draft_tokens;
+    }
+    if (ov::llama_cpp::context_shift == name) {
+        return context_shift;
+    }
+    if (ov::llama_cpp::context_shift_sink_tokens == name) {
+        return context_shift_sink_tokens;
+    }
+    if (ov::llama_cpp::embeddings == name) {
+        return embeddings;
+    }
+    if (ov::llama_cpp::pooling_type == name) {
+        return pooling_type;
+    }
+    if (ov::num_streams == name) {
+        return ov::streams::Num(num_streams);
+    }
+    if (ov::hint::enable_cpu_pinning == name) {
+        return enable_cpu_pinning;
+    }
+    if (ov::llama_cpp::conversion_weights_type == name) {
+        return conversion_weights_type;
+    }
+    OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: getting property ", name, " not implemented");
+}
+
+std::vector<ov::PropertyName> Config::get_supported_properties() {
+    return {ov::PropertyName(ov::inference_num_threads.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::num_streams.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::hint::enable_cpu_pinning.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::enable_profiling.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::logits_last_token_only.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::prefix_cache_size.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::prefix_cache_min_tokens.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::continuous_batching.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::context_size.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::batch_size.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::micro_batch_size.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::kv_cache_type.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::prefill_chunk_size.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::logits_output.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::greedy_output.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::top_k_output.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::sampling_temperature.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::sampling_top_p.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::sampling_seed.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::draft_model.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::num_draft_tokens.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::context_shift.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::context_shift_sink_tokens.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::embeddings.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::pooling_type.name(), ov::PropertyMutability::RW),
+            ov::PropertyName(ov::llama_cpp::conversion_weights_type.name(), ov::PropertyMutability::RW)};
+}
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
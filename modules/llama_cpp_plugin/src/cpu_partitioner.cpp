@@ -0,0 +1,168 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "cpu_partitioner.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "openvino/core/except.hpp"
+
+#ifdef __linux__
+#    include <sched.h>
+#endif
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+namespace {
+// the NUMA node IDs are not necessarily contiguous, so all of the possible ones up to this limit are probed
+constexpr int MAX_NUMA_NODES = 256;
+
+std::vector<int> get_thread_cpus() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &mask)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        cpus.resize(std::max(1u, std::thread::hardware_concurrency()));
+        std::iota(cpus.begin(), cpus.end(), 0);
+    }
+    return cpus;
+}
+
+void set_thread_cpus(const std::vector<int>& cpus) {
+#ifdef __linux__
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (int cpu : cpus) {
+        CPU_SET(cpu, &mask);
+    }
+    sched_setaffinity(0, sizeof(mask), &mask);  // best effort, e.g. the CPUs may have gone offline in the meantime
+#endif
+}
+
+// parses the sysfs CPU list format, e.g. "0-3,8-11"
+std::vector<int> parse_cpu_list(const std::string& cpu_list) {
+    std::vector<int> cpus;
+    std::stringstream stream(cpu_list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty()) {
+            continue;
+        }
+        size_t dash_pos = range.find('-');
+        int first = std::stoi(range.substr(0, dash_pos));
+        int last = dash_pos == std::string::npos ? first : std::stoi(range.substr(dash_pos + 1));
+        for (int cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+}  // namespace
+
+std::vector<std::vector<int>> CpuPartitioner::get_numa_node_cpus() {
+    std::vector<int> available_cpus = get_thread_cpus();
+    std::vector<std::vector<int>> node_cpus;
+#ifdef __linux__
+    std::set<int> available_cpu_set(available_cpus.begin(), available_cpus.end());
+    for (int node = 0; node < MAX_NUMA_NODES; node++) {
+        std::ifstream cpu_list_file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::string cpu_list;
+        if (!cpu_list_file || !std::getline(cpu_list_file, cpu_list)) {
+            continue;
+        }
+        std::vector<int> cpus;
+        for (int cpu : parse_cpu_list(cpu_list)) {
+            if (available_cpu_set.count(cpu) != 0) {
+                cpus.push_back(cpu);
+            }
+        }
+        if (!cpus.empty()) {
+            node_cpus.push_back(cpus);
+        }
+    }
+#endif
+    if (node_cpus.empty()) {
+        node_cpus.push_back(available_cpus);
+    }
+    return node_cpus;
+}
+
+CpuPartitioner::CpuPartitioner(size_t num_partitions) {
+    std::vector<std::vector<int>> node_cpus = get_numa_node_cpus();
+    num_partitions = std::max<size_t>(num_partitions, 1);
+
+    if (num_partitions <= node_cpus.size()) {
+        // whole nodes are assigned to the partitions
+        m_partitions.resize(num_partitions);
+        for (size_t node_idx = 0; node_idx < node_cpus.size(); node_idx++) {
+            auto& partition = m_partitions[node_idx % num_partitions];
+            partition.insert(partition.end(), node_cpus[node_idx].begin(), node_cpus[node_idx].end());
+        }
+    } else {
+        // each of the nodes is split into contiguous ranges of CPUs, so that the partitions stay within the nodes
+        for (size_t node_idx = 0; node_idx < node_cpus.size(); node_idx++) {
+            const std::vector<int>& cpus = node_cpus[node_idx];
+            size_t num_node_partitions =
+                num_partitions / node_cpus.size() + (node_idx < num_partitions % node_cpus.size() ? 1 : 0);
+            for (size_t i = 0; i < num_node_partitions; i++) {
+                size_t begin = cpus.size() * i / num_node_partitions;
+                size_t end = cpus.size() * (i + 1) / num_node_partitions;
+                if (begin == end) {
+                    // more partitions than CPUs in the node - these have to share
+                    m_partitions.push_back({cpus[i % cpus.size()]});
+                } else {
+                    m_partitions.emplace_back(cpus.begin() + begin, cpus.begin() + end);
+                }
+            }
+        }
+    }
+    m_num_users.assign(m_partitions.size(), 0);
+}
+
+size_t CpuPartitioner::acquire_partition() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t partition_idx = std::min_element(m_num_users.begin(), m_num_users.end()) - m_num_users.begin();
+    m_num_users[partition_idx]++;
+    return partition_idx;
+}
+
+void CpuPartitioner::release_partition(size_t partition_idx) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    OPENVINO_ASSERT(partition_idx < m_num_users.size() && m_num_users[partition_idx] != 0);
+    m_num_users[partition_idx]--;
+}
+
+const std::vector<int>& CpuPartitioner::get_cpus(size_t partition_idx) const {
+    return m_partitions.at(partition_idx);
+}
+
+size_t CpuPartitioner::get_num_partitions() const {
+    return m_partitions.size();
+}
+
+ScopedCpuAffinity::ScopedCpuAffinity(const std::vector<int>& cpus) : m_previous_cpus(get_thread_cpus()) {
+    set_thread_cpus(cpus);
+}
+
+ScopedCpuAffinity::~ScopedCpuAffinity() {
+    set_thread_cpus(m_previous_cpus);
+}
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
@@ -0,0 +1,584 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gguf_converter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "llama.h"
+#include "openvino/core/except.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/util/log.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+namespace {
+const std::string EMBEDDED_GGUF_MAGIC = "LLAMA_CPP_EMBEDDED_GGUF";
+constexpr uint32_t EMBEDDED_GGUF_VERSION = 1;
+
+// used if the IR does not contain the rotary embedding frequencies or the RMS norm epsilon in a recognizable form
+constexpr float DEFAULT_ROPE_FREQ_BASE = 10000.0f;
+constexpr float DEFAULT_RMS_NORM_EPS = 1e-6f;
+
+// llama.cpp looks up the byte fallback tokens (at least the one for '\n') when loading a SentencePiece vocabulary,
+// so these follow the <unk>, <s> and </s> tokens in the placeholder vocabulary
+constexpr size_t NUM_SPECIAL_TOKENS = 3;
+constexpr size_t NUM_BYTE_TOKENS = 256;
+
+// llama.cpp token types
+constexpr int32_t TOKEN_TYPE_NORMAL = 1;
+constexpr int32_t TOKEN_TYPE_UNKNOWN = 2;
+constexpr int32_t TOKEN_TYPE_CONTROL = 3;
+constexpr int32_t TOKEN_TYPE_BYTE = 6;
+
+// the GGUF file type values for the "general.file_type" key
+constexpr uint32_t FILE_TYPE_ALL_F32 = 0;
+constexpr uint32_t FILE_TYPE_MOSTLY_F16 = 1;
+constexpr uint32_t FILE_TYPE_MOSTLY_Q8_0 = 7;
+
+constexpr size_t Q8_0_BLOCK_SIZE = 32;
+
+const std::map<std::string, std::string> layer_tensor_names = {{"self_attn.q_proj", "attn_q"},
+                                                               {"self_attn.k_proj", "attn_k"},
+                                                               {"self_attn.v_proj", "attn_v"},
+                                                               {"self_attn.o_proj", "attn_output"},
+                                                               {"mlp.gate_proj", "ffn_gate"},
+                                                               {"mlp.up_proj", "ffn_up"},
+                                                               {"mlp.down_proj", "ffn_down"},
+                                                               {"input_layernorm", "attn_norm"},
+                                                               {"post_attention_layernorm", "ffn_norm"}};
+
+const std::map<std::string, std::string> global_tensor_names = {{"model.embed_tokens", "token_embd"},
+                                                                {"model.norm", "output_norm"},
+                                                                {"lm_head", "output"}};
+
+struct WeightInfo {
+    std::string gguf_name;
+    ov::Output<ov::Node> source;  // the weight after the decompression, if any
+    ov::Shape shape;              // [out, in] for the matrices, regardless of the layout of the source
+    bool is_transposed;           // the source holds the matrix in the [in, out] layout
+    ggml_type type;
+    size_t num_rotary_heads;  // non-zero for the Q and K projections, the rows of which have to be permuted
+};
+
+bool is_decompression_op(const std::shared_ptr<ov::Node>& node) {
+    return ov::is_type<ov::op::v0::Convert>(node) || ov::is_type<ov::op::v1::Subtract>(node) ||
+           ov::is_type<ov::op::v1::Multiply>(node) || ov::is_type<ov::op::v1::Reshape>(node);
+}
+
+bool depends_on_constants_only(const ov::Output<ov::Node>& output) {
+    auto node = output.get_node_shared_ptr();
+    if (ov::is_type<ov::op::v0::Constant>(node)) {
+        return true;
+    }
+    if (!is_decompression_op(node)) {
+        return false;
+    }
+    for (const auto& input : node->input_values()) {
+        if (!depends_on_constants_only(input)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// evaluates the weight decompression subgraph (e.g. the Convert from f16, or the Subtract of the zero point and the
+// Multiply by the scale for the int8 weights) which produces the given output
+std::shared_ptr<ov::op::v0::Constant> fold_weight(const ov::Output<ov::Node>& output) {
+    auto node = output.get_node_shared_ptr();
+    if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node)) {
+        return constant;
+    }
+    OPENVINO_ASSERT(is_decompression_op(node),
+                    "llama_cpp_plugin: unexpected operation ",
+                    *node,
+                    " in a weight subgraph");
+
+    std::vector<std::shared_ptr<ov::op::v0::Constant>> input_constants;
+    ov::TensorVector input_tensors;
+    for (const auto& input : node->input_values()) {
+        input_constants.push_back(fold_weight(input));
+        input_tensors.emplace_back(input_constants.back()->get_element_type(),
+                                   input_constants.back()->get_shape(),
+                                   const_cast<void*>(input_constants.back()->get_data_ptr()));
+    }
+    ov::TensorVector output_tensors;
+    for (const auto& node_output : node->outputs()) {
+        output_tensors.emplace_back(node_output.get_element_type(), node_output.get_shape());
+    }
+    OPENVINO_ASSERT(node->evaluate(output_tensors, input_tensors),
+                    "llama_cpp_plugin: could not evaluate the weight subgraph at ",
+                    *node);
+    const ov::Tensor& result = output_tensors[output.get_index()];
+    return std::make_shared<ov::op::v0::Constant>(result.get_element_type(), result.get_shape(), result.data());
+}
+
+// follows the weight constant through its decompression subgraph up to the output consumed by the model's computation
+ov::Output<ov::Node> get_decompressed_weight(const std::shared_ptr<ov::op::v0::Constant>& constant) {
+    ov::Output<ov::Node> weight = constant->output(0);
+    while (weight.get_target_inputs().size() == 1) {
+        auto consumer = weight.get_target_inputs().begin()->get_node()->shared_from_this();
+        if (!is_decompression_op(consumer) || !depends_on_constants_only(consumer->output(0))) {
+            break;
+        }
+        weight = consumer->output(0);
+    }
+    return weight;
+}
+
+// The matrices are expected in the PyTorch [out, in] layout, which the exported IRs multiply with transpose_b set. A
+// weight consumed by a MatMul without transpose_b is stored in the [in, out] layout instead.
+bool is_transposed_weight(const ov::Output<ov::Node>& weight) {
+    for (const auto& target : weight.get_target_inputs()) {
+        auto matmul = ov::as_type<ov::op::v0::MatMul>(target.get_node());
+        if (matmul == nullptr) {
+            continue;
+        }
+        if (target.get_index() != 1) {
+            OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: the IR conversion does not support the weight ",
+                                           *weight.get_node(),
+                                           " as the first MatMul input");
+        }
+        return !matmul->get_transpose_b();
+    }
+    return false;
+}
+
+ov::Shape get_weight_shape(const ov::Output<ov::Node>& weight) {
+    ov::Shape shape = weight.get_shape();
+    if (shape.size() == 2 && is_transposed_weight(weight)) {
+        std::swap(shape[0], shape[1]);
+    }
+    return shape;
+}
+
+std::vector<float> transpose_matrix(const std::vector<float>& values, size_t num_rows) {
+    size_t num_columns = values.size() / num_rows;
+    std::vector<float> transposed(values.size());
+    for (size_t row = 0; row < num_rows; row++) {
+        for (size_t column = 0; column < num_columns; column++) {
+            transposed[column * num_rows + row] = values[row * num_columns + column];
+        }
+    }
+    return transposed;
+}
+
+// optimum-intel names the weight constants after the PyTorch module parameters, e.g.
+// "self.model.layers.0.self_attn.q_proj.weight"
+std::map<std::string, std::shared_ptr<ov::op::v0::Constant>> find_weight_constants(const ov::Model& model) {
+    static const std::regex layer_weight_regex(
+        R"(^(?:self\.)?model\.layers\.(\d+)\.(self_attn\.[qkvo]_proj|mlp\.(?:gate|up|down)_proj|)"
+        R"(input_layernorm|post_attention_layernorm)\.(weight|bias)$)");
+    static const std::regex global_weight_regex(R"(^(?:self\.)?(model\.embed_tokens|model\.norm|lm_head)\.weight$)");
+
+    std::map<std::string, std::shared_ptr<ov::op::v0::Constant>> weights;
+    for (const auto& node : model.get_ordered_ops()) {
+        auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node);
+        if (!constant) {
+            continue;
+        }
+        std::vector<std::string> names = {constant->get_friendly_name()};
+        const auto& tensor_names = constant->output(0).get_names();
+        names.insert(names.end(), tensor_names.begin(), tensor_names.end());
+        for (const auto& name : names) {
+            std::smatch match;
+            std::string gguf_name;
+            if (std::regex_match(name, match, layer_weight_regex)) {
+                if (match[3] == "bias") {
+                    OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: the IR conversion does not support the ",
+                                                   "projection biases of ",
+                                                   name);
+                }
+                gguf_name = "blk." + match[1].str() + "." + layer_tensor_names.at(match[2].str()) + ".weight";
+            } else if (std::regex_match(name, match, global_weight_regex)) {
+                gguf_name = global_tensor_names.at(match[1].str()) + ".weight";
+            } else {
+                continue;
+            }
+            weights.emplace(gguf_name, constant);
+            break;
+        }
+    }
+    return weights;
+}
+
+float find_rms_norm_eps(const ov::Model& model) {
+    for (const auto& node : model.get_ordered_ops()) {
+        if (!ov::is_type<ov::op::v1::Add>(node)) {
+            continue;
+        }
+        for (size_t i = 0; i < 2; i++) {
+            const ov::Output<ov::Node> eps = node->input_value(1 - i);
+            if (ov::is_type<ov::op::v1::ReduceMean>(node->get_input_node_shared_ptr(i)) &&
+                depends_on_constants_only(eps) && ov::shape_size(eps.get_shape()) == 1) {
+                return fold_weight(eps)->cast_vector<float>()[0];
+            }
+        }
+    }
+    OPENVINO_DEBUG("llama_cpp_plugin: RMS norm epsilon not found in the IR, using the default\n");
+    return DEFAULT_RMS_NORM_EPS;
+}
+
+// the inverse frequencies of the rotary embeddings are base^(-2i/head_size)
+float find_rope_freq_base(const ov::Model& model, size_t head_size) {
+    for (const auto& node : model.get_ordered_ops()) {
+        auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node);
+        if (constant && constant->get_friendly_name().find("inv_freq") != std::string::npos &&
+            ov::shape_size(constant->get_shape()) == head_size / 2) {
+            std::vector<float> inv_freq = constant->cast_vector<float>();
+            return std::pow(inv_freq[1], -static_cast<float>(head_size) / 2.0f);
+        }
+    }
+    OPENVINO_DEBUG("llama_cpp_plugin: rotary embedding frequencies not found in the IR, using the default base\n");
+    return DEFAULT_ROPE_FREQ_BASE;
+}
+
+ggml_type get_weights_ggml_type(const std::string& weights_type) {
+    if (weights_type == "f32") {
+        return GGML_TYPE_F32;
+    }
+    if (weights_type == "f16") {
+        return GGML_TYPE_F16;
+    }
+    OPENVINO_ASSERT(weights_type == "q8_0", "llama_cpp_plugin: unsupported conversion weights type ", weights_type);
+    return GGML_TYPE_Q8_0;
+}
+
+uint32_t get_file_type(ggml_type type) {
+    switch (type) {
+    case GGML_TYPE_F16:
+        return FILE_TYPE_MOSTLY_F16;
+    case GGML_TYPE_Q8_0:
+        return FILE_TYPE_MOSTLY_Q8_0;
+    default:
+        return FILE_TYPE_ALL_F32;
+    }
+}
+
+// converts the HF layout of the Q and K projection rows, in which the rotated dimension pairs of each head are
+// (i, i + head_size / 2), to the llama.cpp one with the pairs (2i, 2i + 1)
+std::vector<float> permute_rotary_rows(const std::vector<float>& values, size_t num_rows, size_t num_heads) {
+    size_t row_size = values.size() / num_rows;
+    size_t half_head_size = num_rows / num_heads / 2;
+    std::vector<float> permuted(values.size());
+    for (size_t head = 0; head < num_heads; head++) {
+        for (size_t half = 0; half < 2; half++) {
+            for (size_t i = 0; i < half_head_size; i++) {
+                size_t src_row = head * 2 * half_head_size + half * half_head_size + i;
+                size_t dst_row = head * 2 * half_head_size + 2 * i + half;
+                std::copy_n(values.begin() + src_row * row_size, row_size, permuted.begin() + dst_row * row_size);
+            }
+        }
+    }
+    return permuted;
+}
+
+std::vector<uint8_t> encode_weight(const std::vector<float>& values, ggml_type type) {
+    std::vector<uint8_t> data;
+    if (type == GGML_TYPE_F32) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(values.data());
+        data.assign(bytes, bytes + values.size() * sizeof(float));
+    } else if (type == GGML_TYPE_F16) {
+        data.resize(values.size() * sizeof(ggml_fp16_t));
+        ggml_fp16_t* fp16_values = reinterpret_cast<ggml_fp16_t*>(data.data());
+        for (size_t i = 0; i < values.size(); i++) {
+            fp16_values[i] = ggml_fp32_to_fp16(values[i]);
+        }
+    } else {
+        // the Q8_0 block is the f16 scale followed by Q8_0_BLOCK_SIZE signed 8-bit values
+        OPENVINO_ASSERT(type == GGML_TYPE_Q8_0 && values.size() % Q8_0_BLOCK_SIZE == 0);
+        const size_t block_bytes = sizeof(ggml_fp16_t) + Q8_0_BLOCK_SIZE;
+        data.resize(values.size() / Q8_0_BLOCK_SIZE * block_bytes);
+        for (size_t block = 0; block < values.size() / Q8_0_BLOCK_SIZE; block++) {
+            const float* block_values = values.data() + block * Q8_0_BLOCK_SIZE;
+            float max_abs = 0.0f;
+            for (size_t i = 0; i < Q8_0_BLOCK_SIZE; i++) {
+                max_abs = std::max(max_abs, std::fabs(block_values[i]));
+            }
+            const float scale = max_abs / 127.0f;
+            const float inv_scale = scale != 0.0f ? 1.0f / scale : 0.0f;
+
+            uint8_t* block_data = data.data() + block * block_bytes;
+            ggml_fp16_t fp16_scale = ggml_fp32_to_fp16(scale);
+            std::copy_n(reinterpret_cast<const uint8_t*>(&fp16_scale), sizeof(fp16_scale), block_data);
+            int8_t* quants = reinterpret_cast<int8_t*>(block_data + sizeof(ggml_fp16_t));
+            for (size_t i = 0; i < Q8_0_BLOCK_SIZE; i++) {
+                quants[i] = static_cast<int8_t>(std::round(block_values[i] * inv_scale));
+            }
+        }
+    }
+    return data;
+}
+
+void set_placeholder_vocab(gguf_context* gguf_ctx, size_t n_vocab) {
+    std::vector<std::string> tokens(n_vocab);
+    std::vector<float> scores(n_vocab, 0.0f);
+    std::vector<int32_t> token_types(n_vocab, TOKEN_TYPE_NORMAL);
+    tokens[0] = "<unk>";
+    token_types[0] = TOKEN_TYPE_UNKNOWN;
+    tokens[1] = "<s>";
+    token_types[1] = TOKEN_TYPE_CONTROL;
+    tokens[2] = "</s>";
+    token_types[2] = TOKEN_TYPE_CONTROL;
+    for (size_t i = 0; i < NUM_BYTE_TOKENS; i++) {
+        char byte_token[8];
+        std::snprintf(byte_token, sizeof(byte_token), "<0x%02X>", static_cast<unsigned>(i));
+        tokens[NUM_SPECIAL_TOKENS + i] = byte_token;
+        token_types[NUM_SPECIAL_TOKENS + i] = TOKEN_TYPE_BYTE;
+    }
+    for (size_t i = NUM_SPECIAL_TOKENS + NUM_BYTE_TOKENS; i < n_vocab; i++) {
+        tokens[i] = "[TOKEN_" + std::to_string(i) + "]";
+    }
+
+    std::vector<const char*> token_ptrs;
+    for (const auto& token : tokens) {
+        token_ptrs.push_back(token.c_str());
+    }
+    gguf_set_val_str(gguf_ctx, "tokenizer.ggml.model", "llama");
+    gguf_set_arr_str(gguf_ctx, "tokenizer.ggml.tokens", token_ptrs.data(), static_cast<int>(n_vocab));
+    gguf_set_arr_data(gguf_ctx, "tokenizer.ggml.scores", GGUF_TYPE_FLOAT32, scores.data(), static_cast<int>(n_vocab));
+    gguf_set_arr_data(gguf_ctx,
+                      "tokenizer.ggml.token_type",
+                      GGUF_TYPE_INT32,
+                      token_types.data(),
+                      static_cast<int>(n_vocab));
+    gguf_set_val_u32(gguf_ctx, "tokenizer.ggml.unknown_token_id", 0);
+    gguf_set_val_u32(gguf_ctx, "tokenizer.ggml.bos_token_id", 1);
+    gguf_set_val_u32(gguf_ctx, "tokenizer.ggml.eos_token_id", 2);
+}
+}  // namespace
+
+void convert_model_to_gguf(const std::shared_ptr<const ov::Model>& model,
+                           const std::string& gguf_fname,
+                           const std::string& weights_type,
+                           uint32_t context_length) {
+    const ggml_type matrix_type = get_weights_ggml_type(weights_type);
+    std::map<std::string, std::shared_ptr<ov::op::v0::Constant>> weight_constants = find_weight_constants(*model);
+    auto get_constant = [&weight_constants](const std::string& gguf_name) {
+        auto it = weight_constants.find(gguf_name);
+        if (it == weight_constants.end()) {
+            OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: only the stateful LLaMA-like decoder IRs exported by ",
+                                           "optimum-intel can be converted to GGUF, and the weight for ",
+                                           gguf_name,
+                                           " was not found");
+        }
+        return it->second;
+    };
+
+    // the KV cache variables of such IRs have the [batch, KV heads, tokens, head size] shape
+    size_t n_head_kv = 0;
+    size_t head_size = 0;
+    for (const auto& variable : model->get_variables()) {
+        const ov::PartialShape& shape = variable->get_info().data_shape;
+        if (shape.rank().is_static() && shape.size() == 4 && shape[1].is_static() && shape[3].is_static()) {
+            n_head_kv = shape[1].get_length();
+            head_size = shape[3].get_length();
+            break;
+        }
+    }
+    if (head_size == 0) {
+        OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: only the stateful LLM IRs can be converted to GGUF, and ",
+                                       model->get_friendly_name(),
+                                       " has no KV cache variables with static head dimensions");
+    }
+
+    size_t n_layers = 0;
+    while (weight_constants.count("blk." + std::to_string(n_layers) + ".attn_q.weight") != 0) {
+        n_layers++;
+    }
+    OPENVINO_ASSERT(n_layers != 0, "llama_cpp_plugin: no transformer layers found in ", model->get_friendly_name());
+
+    const ov::Shape embedding_shape = get_weight_shape(get_decompressed_weight(get_constant("token_embd.weight")));
+    const size_t n_vocab = embedding_shape[0];
+    const size_t n_embd = embedding_shape[1];
+    const size_t n_ff = get_weight_shape(get_decompressed_weight(get_constant("blk.0.ffn_up.weight")))[0];
+    const size_t n_head =
+        get_weight_shape(get_decompressed_weight(get_constant("blk.0.attn_q.weight")))[0] / head_size;
+    OPENVINO_ASSERT(n_vocab >= NUM_SPECIAL_TOKENS + NUM_BYTE_TOKENS,
+                    "llama_cpp_plugin: the vocabulary of ",
+                    n_vocab,
+                    " tokens is too small for the conversion");
+
+    // pairs of the GGUF tensor name and the name of the weight it is taken from; the output projection may be tied to
+    // the token embeddings, in which case lm_head has no weight of its own
+    bool has_output_weight = weight_constants.count("output.weight") != 0;
+    std::vector<std::pair<std::string, std::string>> gguf_names = {
+        {"token_embd.weight", "token_embd.weight"},
+        {"output_norm.weight", "output_norm.weight"},
+        {"output.weight", has_output_weight ? "output.weight" : "token_embd.weight"}};
+    for (size_t layer = 0; layer < n_layers; layer++) {
+        for (const auto& layer_tensor_name : layer_tensor_names) {
+            std::string gguf_name = "blk." + std::to_string(layer) + "." + layer_tensor_name.second + ".weight";
+            gguf_names.emplace_back(gguf_name, gguf_name);
+        }
+    }
+
+    std::vector<WeightInfo> weights;
+    for (const auto& names : gguf_names) {
+        WeightInfo weight;
+        weight.gguf_name = names.first;
+        weight.source = get_decompressed_weight(get_constant(names.second));
+        const ov::Shape& shape = weight.source.get_shape();
+        weight.is_transposed = shape.size() == 2 && is_transposed_weight(weight.source);
+        weight.shape = get_weight_shape(weight.source);
+        OPENVINO_ASSERT(shape.size() == 1 || shape.size() == 2,
+                        "llama_cpp_plugin: unexpected shape ",
+                        shape,
+                        " of the weight for ",
+                        weight.gguf_name);
+        // the norm weights and the matrices with rows not divisible into the quantization blocks are kept in f32
+        bool is_quantizable = shape.size() == 2 && weight.shape[1] % ggml_blck_size(matrix_type) == 0;
+        weight.type = is_quantizable ? matrix_type : GGML_TYPE_F32;
+        weight.num_rotary_heads = 0;
+        if (weight.gguf_name.find(".attn_q.") != std::string::npos) {
+            weight.num_rotary_heads = n_head;
+        } else if (weight.gguf_name.find(".attn_k.") != std::string::npos) {
+            weight.num_rotary_heads = n_head_kv;
+        }
+        weights.push_back(weight);
+    }
+
+    std::unique_ptr<gguf_context, decltype(&gguf_free)> gguf_ctx(gguf_init_empty(), gguf_free);
+    gguf_set_val_str(gguf_ctx.get(), "general.architecture", "llama");
+    gguf_set_val_str(gguf_ctx.get(), "general.name", model->get_friendly_name().c_str());
+    gguf_set_val_u32(gguf_ctx.get(), "general.file_type", get_file_type(matrix_type));
+    gguf_set_val_u32(gguf_ctx.get(), "llama.context_length", context_length);
+    gguf_set_val_u32(gguf_ctx.get(), "llama.embedding_length", static_cast<uint32_t>(n_embd));
+    gguf_set_val_u32(gguf_ctx.get(), "llama.block_count", static_cast<uint32_t>(n_layers));
+    gguf_set_val_u32(gguf_ctx.get(), "llama.feed_forward_length", static_cast<uint32_t>(n_ff));
+    gguf_set_val_u32(gguf_ctx.get(), "llama.rope.dimension_count", static_cast<uint32_t>(head_size));
+    gguf_set_val_u32(gguf_ctx.get(), "llama.attention.head_count", static_cast<uint32_t>(n_head));
+    gguf_set_val_u32(gguf_ctx.get(), "llama.attention.head_count_kv", static_cast<uint32_t>(n_head_kv));
+    gguf_set_val_f32(gguf_ctx.get(), "llama.attention.layer_norm_rms_epsilon", find_rms_norm_eps(*model));
+    gguf_set_val_f32(gguf_ctx.get(), "llama.rope.freq_base", find_rope_freq_base(*model, head_size));
+    set_placeholder_vocab(gguf_ctx.get(), n_vocab);
+
+    // the tensors only describe the weights for the GGUF metadata; the data is written separately one weight at a time
+    // to avoid holding the entire converted model in memory
+    ggml_init_params params = {ggml_tensor_overhead() * weights.size(), nullptr, true};
+    std::unique_ptr<ggml_context, decltype(&ggml_free)> ggml_ctx(ggml_init(params), ggml_free);
+    for (const auto& weight : weights) {
+        const ov::Shape& shape = weight.shape;
+        ggml_tensor* tensor = shape.size() == 2 ? ggml_new_tensor_2d(ggml_ctx.get(), weight.type, shape[1], shape[0])
+                                                : ggml_new_tensor_1d(ggml_ctx.get(), weight.type, shape[0]);
+        ggml_set_name(tensor, weight.gguf_name.c_str());
+        gguf_add_tensor(gguf_ctx.get(), tensor);
+    }
+    gguf_write_to_file(gguf_ctx.get(), gguf_fname.c_str(), /* only_meta = */ true);
+
+    std::ofstream out(gguf_fname, std::ios::binary | std::ios::app);
+    OPENVINO_ASSERT(out.good(), "llama_cpp_plugin: could not open ", gguf_fname, " for writing");
+    const size_t alignment = gguf_get_alignment(gguf_ctx.get());
+    for (const auto& weight : weights) {
+        std::vector<float> values = fold_weight(weight.source)->cast_vector<float>();
+        if (weight.is_transposed) {
+            values = transpose_matrix(values, weight.source.get_shape()[0]);
+        }
+        if (weight.num_rotary_heads != 0) {
+            values = permute_rotary_rows(values, weight.shape[0], weight.num_rotary_heads);
+        }
+        std::vector<uint8_t> data = encode_weight(values, weight.type);
+        data.resize((data.size() + alignment - 1) / alignment * alignment, 0);
+        out.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+    OPENVINO_ASSERT(out.good(), "llama_cpp_plugin: failed to write the converted model to ", gguf_fname);
+    OPENVINO_DEBUG("llama_cpp_plugin: converted ", model->get_friendly_name(), " to GGUF at ", gguf_fname, "\n");
+}
+
+TemporaryGgufFile::TemporaryGgufFile() {
+#ifdef _WIN32
+    char temp_dir[MAX_PATH + 1];
+    char temp_path[MAX_PATH + 1];
+    OPENVINO_ASSERT(GetTempPathA(sizeof(temp_dir), temp_dir) != 0 &&
+                        GetTempFileNameA(temp_dir, "gguf", 0, temp_path) != 0,
+                    "llama_cpp_plugin: could not create a temporary GGUF file");
+    m_path = temp_path;
+#else
+    const char* temp_dir = std::getenv("TMPDIR");
+    std::string path_template = std::string(temp_dir != nullptr ? temp_dir : "/tmp") + "/llama_cpp_plugin_XXXXXX.gguf";
+    std::vector<char> path(path_template.begin(), path_template.end());
+    path.push_back('\0');
+    int fd = mkstemps(path.data(), sizeof(".gguf") - 1);
+    OPENVINO_ASSERT(fd != -1, "llama_cpp_plugin: could not create a temporary GGUF file in ", path_template);
+    close(fd);
+    m_path = path.data();
+#endif
+}
+
+TemporaryGgufFile::~TemporaryGgufFile() {
+    std::remove(m_path.c_str());
+}
+
+const std::string& TemporaryGgufFile::get_path() const {
+    return m_path;
+}
+
+void write_embedded_gguf(const std::string& gguf_fname, std::ostream& stream) {
+    std::ifstream in(gguf_fname, std::ios::binary | std::ios::ate);
+    OPENVINO_ASSERT(in.good(), "llama_cpp_plugin: could not open ", gguf_fname, " for reading");
+    uint64_t size = static_cast<uint64_t>(in.tellg());
+    in.seekg(0);
+    stream << EMBEDDED_GGUF_MAGIC << ' ' << EMBEDDED_GGUF_VERSION << ' ' << size << '\n';
+    stream << in.rdbuf();
+}
+
+std::shared_ptr<TemporaryGgufFile> read_embedded_gguf(std::istream& stream) {
+    std::streampos start = stream.tellg();
+    std::string magic;
+    stream >> magic;
+    if (magic != EMBEDDED_GGUF_MAGIC) {
+        stream.clear();
+        stream.seekg(start);
+        return nullptr;
+    }
+    uint32_t version = 0;
+    uint64_t size = 0;
+    stream >> version >> size;
+    stream.ignore(1);  // the newline separating the header from the file contents
+    OPENVINO_ASSERT(stream.good(), "llama_cpp_plugin: malformed embedded GGUF header");
+    OPENVINO_ASSERT(version == EMBEDDED_GGUF_VERSION, "llama_cpp_plugin: unsupported embedded GGUF version ", version);
+
+    auto gguf_file = std::make_shared<TemporaryGgufFile>();
+    std::ofstream out(gguf_file->get_path(), std::ios::binary | std::ios::trunc);
+    std::vector<char> buffer(1 << 20);
+    while (size != 0) {
+        size_t chunk_size = static_cast<size_t>(std::min<uint64_t>(size, buffer.size()));
+        stream.read(buffer.data(), chunk_size);
+        OPENVINO_ASSERT(static_cast<size_t>(stream.gcount()) == chunk_size,
+                        "llama_cpp_plugin: the embedded GGUF file is truncated");
+        out.write(buffer.data(), chunk_size);
+        size -= chunk_size;
+    }
+    OPENVINO_ASSERT(out.good(), "llama_cpp_plugin: failed to write ", gguf_file->get_path());
+    return gguf_file;
+}
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
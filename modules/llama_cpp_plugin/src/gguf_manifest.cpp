@@ -0,0 +1,105 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "gguf_manifest.hpp"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/util/file_util.hpp"
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+namespace {
+const std::string MANIFEST_MAGIC = "LLAMA_CPP_GGUF_MANIFEST";
+constexpr uint32_t MANIFEST_VERSION = 1;
+
+// Only the head and the tail of the file are hashed - the head contains the GGUF metadata and tensor infos, and hashing
+// the entire multi-GB tensor data would defeat the purpose of the fast cached startup.
+constexpr uint64_t HASHED_CHUNK_SIZE = 1 << 20;
+
+uint64_t fnv1a_update(uint64_t hash, const char* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+uint64_t compute_sampled_hash(const std::string& fname, uint64_t file_size) {
+    std::ifstream in(fname, std::ios::binary);
+    OPENVINO_ASSERT(in.good(), "llama_cpp_plugin: could not open ", fname, " for hashing");
+
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = fnv1a_update(hash, reinterpret_cast<const char*>(&file_size), sizeof(file_size));
+
+    std::vector<char> buffer(std::min(file_size, HASHED_CHUNK_SIZE));
+    in.read(buffer.data(), buffer.size());
+    hash = fnv1a_update(hash, buffer.data(), in.gcount());
+
+    if (file_size > 2 * HASHED_CHUNK_SIZE) {
+        in.seekg(file_size - HASHED_CHUNK_SIZE);
+        in.read(buffer.data(), buffer.size());
+        hash = fnv1a_update(hash, buffer.data(), in.gcount());
+    }
+    return hash;
+}
+
+void stat_file(const std::string& fname, uint64_t& size, int64_t& mtime) {
+    struct stat file_stat;
+    OPENVINO_ASSERT(stat(fname.c_str(), &file_stat) == 0, "llama_cpp_plugin: could not stat ", fname);
+    size = static_cast<uint64_t>(file_stat.st_size);
+    mtime = static_cast<int64_t>(file_stat.st_mtime);
+}
+}  // namespace
+
+GgufManifest GgufManifest::from_file(const std::string& gguf_fname) {
+    GgufManifest manifest;
+    manifest.path = ov::util::get_absolute_file_path(gguf_fname);
+    stat_file(manifest.path, manifest.size, manifest.mtime);
+    manifest.hash = compute_sampled_hash(manifest.path, manifest.size);
+    return manifest;
+}
+
+GgufManifest GgufManifest::read(std::istream& stream) {
+    std::string magic;
+    uint32_t version = 0;
+    stream >> magic >> version;
+    OPENVINO_ASSERT(stream.good() && magic == MANIFEST_MAGIC, "llama_cpp_plugin: not a GGUF manifest blob");
+    OPENVINO_ASSERT(version == MANIFEST_VERSION, "llama_cpp_plugin: unsupported GGUF manifest version ", version);
+
+    GgufManifest manifest;
+    stream >> manifest.size >> manifest.mtime >> manifest.hash;
+    stream.ignore(1);  // the newline separating the numeric fields from the path
+    std::getline(stream, manifest.path);
+    OPENVINO_ASSERT(!stream.fail() && !manifest.path.empty(), "llama_cpp_plugin: malformed GGUF manifest");
+    return manifest;
+}
+
+void GgufManifest::write(std::ostream& stream) const {
+    stream << MANIFEST_MAGIC << ' ' << MANIFEST_VERSION << '\n';
+    stream << size << ' ' << mtime << ' ' << hash << '\n';
+    stream << path << '\n';
+}
+
+void GgufManifest::validate() const {
+    uint64_t current_size = 0;
+    int64_t current_mtime = 0;
+    stat_file(path, current_size, current_mtime);
+    OPENVINO_ASSERT(current_size == size && current_mtime == mtime,
+                    "llama_cpp_plugin: GGUF file ",
+                    path,
+                    " was modified since the cache entry was created");
+    OPENVINO_ASSERT(compute_sampled_hash(path, current_size) == hash,
+                    "llama_cpp_plugin: GGUF file ",
+                    path,
+                    " content does not match the cache entry");
+}
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
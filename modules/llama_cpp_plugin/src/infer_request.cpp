@@ -3,13 +3,19 @@
 
 #include "infer_request.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <string>
 #include <openvino/runtime/ivariable_state.hpp>
-#include <thread>
 
 #include "llama.h"
 #include "openvino/runtime/make_tensor.hpp"
 #include "openvino/util/log.hpp"
+#include "cpu_partitioner.hpp"
+#include "prefix_cache.hpp"
+#include "scheduler.hpp"
 #include "state.hpp"
 
 namespace ov {
@@ -25,14 +31,31 @@ void allocate_tensor_impl(ov::SoPtr<ov::ITensor>& tensor,
     }
 }
 
-LlamaCppSyncInferRequest::LlamaCppSyncInferRequest(const std::shared_ptr<const LlamaCppModel>& compiled_model,
-                                                   size_t num_threads)
-    : ov::ISyncInferRequest(compiled_model) {
+LlamaCppSyncInferRequest::LlamaCppSyncInferRequest(const std::shared_ptr<const LlamaCppModel>& compiled_model)
+    : ov::ISyncInferRequest(compiled_model),
+      m_sampler(compiled_model->m_config.sampling_temperature,
+                compiled_model->m_config.sampling_top_p,
+                compiled_model->m_config.sampling_seed) {
     OPENVINO_DEBUG("llama_cpp_plugin: infer request ctor called\n");
-    llama_context_params cparams = llama_context_default_params();
-    cparams.n_threads = num_threads ? num_threads : std::thread::hardware_concurrency();
-    cparams.n_ctx = 0;  // this means that the actual n_ctx will be taken equal to the model's train-time value
-    m_llama_ctx = llama_new_context_with_model(compiled_model->m_llama_model_ptr, cparams);
+    m_scheduler = compiled_model->m_scheduler.get();
+    llama_context_params cparams = compiled_model->get_context_params();
+    if (m_scheduler != nullptr) {
+        m_llama_ctx = m_scheduler->get_context();
+        m_first_seq_id = m_scheduler->acquire_sequences();
+    } else {
+        m_cpu_partitioner = compiled_model->m_cpu_partitioner.get();
+        m_cpu_partition_idx = m_cpu_partitioner->acquire_partition();
+        if (compiled_model->m_config.num_threads == 0) {
+            // the requests running in parallel on the other streams use the rest of the cores
+            uint32_t n_partition_cpus = m_cpu_partitioner->get_cpus(m_cpu_partition_idx).size();
+            cparams.n_threads = n_partition_cpus;
+            cparams.n_threads_batch = n_partition_cpus;
+        }
+        m_llama_ctx = llama_new_context_with_model(compiled_model->m_llama_model_ptr, cparams);
+    }
+    if (compiled_model->m_draft_llama_model) {
+        m_draft_llama_ctx = llama_new_context_with_model(compiled_model->m_draft_llama_model.get(), cparams);
+    }
     m_compiled_model_ptr = compiled_model;
     for (const auto& input : get_inputs()) {
         allocate_tensor(input, [input](ov::SoPtr<ov::ITensor>& tensor) {
@@ -57,20 +80,401 @@ void LlamaCppSyncInferRequest::set_tensors_impl(const ov::Output<const ov::Node>
 void llama_batch_add_reimpl(struct llama_batch& batch,
                             llama_token id,
                             llama_pos pos,
-                            const std::vector<llama_seq_id>& seq_ids,
+                            llama_seq_id seq_id,
                             bool logits) {
     batch.token[batch.n_tokens] = id;
     batch.pos[batch.n_tokens] = pos;
-    batch.n_seq_id[batch.n_tokens] = seq_ids.size();
-    for (size_t i = 0; i < seq_ids.size(); ++i) {
-        batch.seq_id[batch.n_tokens][i] = seq_ids[i];
-    }
+    batch.n_seq_id[batch.n_tokens] = 1;
+    batch.seq_id[batch.n_tokens][0] = seq_id;
     batch.logits[batch.n_tokens] = logits;
 
     batch.n_tokens++;
 }
 
+ov::SoPtr<ov::ITensor> LlamaCppSyncInferRequest::allocate_output(const ov::Output<const ov::Node>& port,
+                                                                 const ov::element::Type& element_type,
+                                                                 const ov::Shape& shape) {
+    allocate_tensor(port, [&element_type, &shape](ov::SoPtr<ov::ITensor>& tensor) {
+        allocate_tensor_impl(tensor, element_type, shape);
+    });
+    return get_tensor(port);
+}
+
+void LlamaCppSyncInferRequest::reserve_batch(size_t n_tokens) {
+    // The batch (including the per-token sequence ID storage) is only reallocated when growing, so that in the
+    // steady state of the token-by-token generation no heap allocations take place.
+    if (n_tokens > m_batch_capacity) {
+        if (m_batch_capacity != 0) {
+            llama_batch_free(m_batch);
+        }
+        m_batch = llama_batch_init(n_tokens, /* embd = */ 0, /* n_seq_max = */ 1);
+        m_batch_capacity = n_tokens;
+    }
+    m_batch.n_tokens = 0;
+}
+
+void LlamaCppSyncInferRequest::reorder_kv_cache(const ov::SoPtr<ov::ITensor>& beam_idx_tensor_ptr, size_t batch_size) {
+    if (beam_idx_tensor_ptr->get_size() == 0 || m_sequence_info.num_sequences == 0) {
+        return;  // beam_idx was not set, or there is no history to reorder yet
+    }
+    OPENVINO_ASSERT(beam_idx_tensor_ptr->get_element_type() == ov::element::Type_t::i32);
+    OPENVINO_ASSERT(beam_idx_tensor_ptr->get_size() == batch_size,
+                    "llama_cpp_plugin: beam_idx size ",
+                    beam_idx_tensor_ptr->get_size(),
+                    " does not match the batch size ",
+                    batch_size);
+    const int32_t* beam_idx = beam_idx_tensor_ptr->data<int32_t>();
+
+    bool is_identity = true;
+    for (size_t i = 0; i < batch_size; i++) {
+        OPENVINO_ASSERT(beam_idx[i] >= 0 && static_cast<size_t>(beam_idx[i]) < m_sequence_info.num_sequences,
+                        "llama_cpp_plugin: beam_idx value ",
+                        beam_idx[i],
+                        " does not refer to any of the ",
+                        m_sequence_info.num_sequences,
+                        " sequences of the previous inference");
+        is_identity = is_identity && (static_cast<size_t>(beam_idx[i]) == i);
+    }
+    if (is_identity && batch_size == m_sequence_info.num_sequences) {
+        return;
+    }
+
+    // The sources are first copied to scratch sequence IDs outside of both the previous and the current range, so
+    // that no sequence is overwritten before all of its copies are made. llama_kv_cache_seq_cp does not copy the KV
+    // data, but only marks the existing cells as belonging to the destination sequence as well, so that the common
+    // history of the beams is stored (and was computed) only once.
+    const llama_seq_id first_seq_id = m_first_seq_id;
+    const llama_seq_id scratch_seq_id =
+        first_seq_id + static_cast<llama_seq_id>(std::max(m_sequence_info.num_sequences, batch_size));
+    run_on_context([&](llama_context* ctx) {
+        for (size_t i = 0; i < batch_size; i++) {
+            llama_kv_cache_seq_cp(ctx, first_seq_id + beam_idx[i], scratch_seq_id + i, -1, -1);
+        }
+        for (llama_seq_id seq_id = first_seq_id; seq_id < scratch_seq_id; seq_id++) {
+            llama_kv_cache_seq_rm(ctx, seq_id, -1, -1);
+        }
+        for (size_t i = 0; i < batch_size; i++) {
+            llama_kv_cache_seq_cp(ctx, scratch_seq_id + i, first_seq_id + i, -1, -1);
+            llama_kv_cache_seq_rm(ctx, scratch_seq_id + i, -1, -1);
+        }
+    });
+}
+
+void LlamaCppSyncInferRequest::run_on_context(const std::function<void(llama_context*)>& fn) const {
+    if (m_scheduler != nullptr) {
+        m_scheduler->run_exclusive(fn);
+    } else {
+        fn(m_llama_ctx);
+    }
+}
+
+void LlamaCppSyncInferRequest::decode(const InferTask& task, size_t begin, size_t end) {
+    auto batch_building_start = std::chrono::steady_clock::now();
+    reserve_batch(end - begin);
+    size_t first_output_token_idx = task.sequence_length - task.n_output_tokens;
+
+    for (size_t idx = begin; idx < end; ++idx) {
+        if (task.is_padding(idx)) {
+            continue;  // neither computed nor stored in the KV cache
+        }
+        const size_t seq_idx = idx / task.sequence_length;
+        const size_t tok_idx = idx % task.sequence_length;
+        // marks whether the logits for this token should be computed and returned
+        const bool compute_logits = tok_idx >= first_output_token_idx;
+        llama_batch_add_reimpl(m_batch,
+                               task.input_ids[idx],
+                               task.get_position(idx),
+                               m_first_seq_id + seq_idx,
+                               compute_logits);
+    }
+
+    auto eval_start = std::chrono::steady_clock::now();
+    m_profiling_stats.batch_building.add(eval_start - batch_building_start);
+    auto logits_extraction_before = m_profiling_stats.logits_extraction.time;
+
+    if (m_batch.n_tokens == 0) {
+        extract_logits(task, begin, end, 0);  // the range only consists of padding
+    } else if (m_scheduler != nullptr) {
+        m_scheduler->decode(m_batch, [this, &task, begin, end](int32_t batch_offset) {
+            extract_logits(task, begin, end, batch_offset);
+        });
+    } else {
+        int32_t sts = llama_decode(m_llama_ctx, m_batch);
+
+        if (sts != 0) {
+            OPENVINO_THROW("llama_decode failed with code ", sts);
+        }
+        extract_logits(task, begin, end, 0);
+    }
+
+    // the logits extraction is run from within the decode call and accounted separately
+    auto eval_time = std::chrono::steady_clock::now() - eval_start -
+                     (m_profiling_stats.logits_extraction.time - logits_extraction_before);
+    if (task.sequence_length > 1) {
+        m_profiling_stats.prompt_eval.add(eval_time);
+        m_profiling_stats.n_prompt_tokens += m_batch.n_tokens;
+    } else {
+        m_profiling_stats.token_eval.add(eval_time);
+        m_profiling_stats.n_eval_tokens += m_batch.n_tokens;
+    }
+}
+
+void LlamaCppSyncInferRequest::extract_logits(const InferTask& task, size_t begin, size_t end, int32_t batch_offset) {
+    auto extraction_start = std::chrono::steady_clock::now();
+    size_t first_output_token_idx = task.sequence_length - task.n_output_tokens;
+    size_t n_vocab = llama_n_vocab(m_compiled_model_ptr->m_llama_model_ptr);
+    int32_t next_batch_pos = batch_offset;
+    for (size_t idx = begin; idx < end; ++idx) {
+        const size_t seq_idx = idx / task.sequence_length;
+        const size_t tok_idx = idx % task.sequence_length;
+        const bool is_padding = task.is_padding(idx);
+        const int32_t batch_pos = is_padding ? -1 : next_batch_pos++;
+        if (tok_idx < first_output_token_idx) {
+            continue;
+        }
+        size_t output_row = seq_idx * task.n_output_tokens + (tok_idx - first_output_token_idx);
+        if (is_padding) {
+            fill_padding_outputs(task, output_row);
+            continue;
+        }
+        if (task.hidden_states != nullptr || task.embeddings != nullptr) {
+            extract_embeddings(task, seq_idx, output_row, batch_pos);
+            continue;
+        }
+        const float* logits_from_llama = llama_get_logits_ith(m_llama_ctx, batch_pos);
+        if (task.logits != nullptr) {
+            std::copy(logits_from_llama, logits_from_llama + n_vocab, task.logits + output_row * n_vocab);
+        }
+        if (task.greedy_token_ids != nullptr) {
+            task.greedy_token_ids[output_row] = LogitsSampler::get_greedy_token(logits_from_llama, n_vocab);
+        }
+        if (task.top_k_token_ids != nullptr) {
+            size_t k = m_compiled_model_ptr->m_config.top_k_output;
+            m_sampler.get_top_k_tokens(logits_from_llama,
+                                       n_vocab,
+                                       k,
+                                       task.top_k_token_ids + output_row * k,
+                                       task.top_k_probs + output_row * k);
+        }
+        if (task.sampled_token_ids != nullptr) {
+            task.sampled_token_ids[output_row] = m_sampler.sample_token(logits_from_llama, n_vocab);
+        }
+    }
+    m_profiling_stats.logits_extraction.add(std::chrono::steady_clock::now() - extraction_start);
+}
+
+void LlamaCppSyncInferRequest::fill_padding_outputs(const InferTask& task, size_t output_row) {
+    size_t n_vocab = llama_n_vocab(m_compiled_model_ptr->m_llama_model_ptr);
+    size_t k = m_compiled_model_ptr->m_config.top_k_output;
+    if (task.logits != nullptr) {
+        std::fill_n(task.logits + output_row * n_vocab, n_vocab, 0.0f);
+    }
+    if (task.greedy_token_ids != nullptr) {
+        task.greedy_token_ids[output_row] = 0;
+    }
+    if (task.top_k_token_ids != nullptr) {
+        std::fill_n(task.top_k_token_ids + output_row * k, k, 0);
+        std::fill_n(task.top_k_probs + output_row * k, k, 0.0f);
+    }
+    if (task.sampled_token_ids != nullptr) {
+        task.sampled_token_ids[output_row] = 0;
+    }
+    if (task.hidden_states != nullptr) {
+        size_t n_embd = llama_n_embd(m_compiled_model_ptr->m_llama_model_ptr);
+        std::fill_n(task.hidden_states + output_row * n_embd, n_embd, 0.0f);
+    }
+}
+
+void LlamaCppSyncInferRequest::extract_embeddings(const InferTask& task,
+                                                  size_t seq_idx,
+                                                  size_t output_row,
+                                                  int32_t batch_pos) {
+    size_t n_embd = llama_n_embd(m_compiled_model_ptr->m_llama_model_ptr);
+    const float* embd_from_llama = llama_get_embeddings_ith(m_llama_ctx, batch_pos);
+    if (task.hidden_states != nullptr) {
+        std::copy(embd_from_llama, embd_from_llama + n_embd, task.hidden_states + output_row * n_embd);
+        return;
+    }
+
+    // the tokens of a sequence are extracted in their order, possibly over several chunks
+    float* pooled = task.embeddings + seq_idx * n_embd;
+    const std::string& pooling_type = m_compiled_model_ptr->m_config.pooling_type;
+    if (pooling_type == "mean") {
+        std::transform(pooled, pooled + n_embd, embd_from_llama, pooled, std::plus<float>());
+    } else if (pooling_type == "last" || m_num_pooled_tokens[seq_idx] == 0) {
+        std::copy(embd_from_llama, embd_from_llama + n_embd, pooled);
+    }
+    m_num_pooled_tokens[seq_idx]++;
+}
+
+void LlamaCppSyncInferRequest::decode_chunked(const InferTask& task, size_t begin, size_t end) {
+    // The tokens are submitted in chunks of bounded size, so that the memory llama.cpp allocates for a single batch
+    // does not grow with the prompt length. The logits are written out after each chunk.
+    size_t chunk_size = get_chunk_size(m_llama_ctx);
+    for (size_t chunk_begin = begin; chunk_begin < end; chunk_begin += chunk_size) {
+        decode(task, chunk_begin, std::min(chunk_begin + chunk_size, end));
+    }
+}
+
+size_t LlamaCppSyncInferRequest::get_chunk_size(llama_context* ctx) const {
+    // llama_decode aborts the process on batches exceeding n_batch, so larger chunk sizes are clamped
+    size_t chunk_size = m_compiled_model_ptr->m_config.prefill_chunk_size;
+    return chunk_size != 0 ? std::min<size_t>(chunk_size, llama_n_batch(ctx)) : llama_n_batch(ctx);
+}
+
+void LlamaCppSyncInferRequest::propose_draft_tokens(const InferTask& task) {
+    // The draft model has not seen the input yet; the draft tokens are then generated greedily one by one, starting
+    // from its prediction for the last input token.
+    size_t chunk_size = get_chunk_size(m_draft_llama_ctx);
+    for (size_t chunk_begin = 0; chunk_begin < task.sequence_length; chunk_begin += chunk_size) {
+        size_t chunk_end = std::min(chunk_begin + chunk_size, task.sequence_length);
+        reserve_batch(chunk_end - chunk_begin);
+        for (size_t idx = chunk_begin; idx < chunk_end; ++idx) {
+            llama_batch_add_reimpl(m_batch,
+                                   task.input_ids[idx],
+                                   task.get_position(idx),
+                                   0,
+                                   idx == task.sequence_length - 1);
+        }
+        int32_t sts = llama_decode(m_draft_llama_ctx, m_batch);
+        OPENVINO_ASSERT(sts == 0, "llama_cpp_plugin: llama_decode failed for the draft model with code ", sts);
+    }
+
+    size_t n_vocab = llama_n_vocab(m_compiled_model_ptr->m_llama_model_ptr);
+    size_t n_draft = m_compiled_model_ptr->m_config.num_draft_tokens;
+    llama_pos last_pos = task.get_position(task.sequence_length - 1);
+    m_draft_tokens.clear();
+    m_draft_tokens.push_back(
+        LogitsSampler::get_greedy_token(llama_get_logits_ith(m_draft_llama_ctx, m_batch.n_tokens - 1), n_vocab));
+    while (m_draft_tokens.size() < n_draft) {
+        reserve_batch(1);
+        llama_pos pos = last_pos + static_cast<llama_pos>(m_draft_tokens.size());
+        llama_batch_add_reimpl(m_batch, m_draft_tokens.back(), pos, 0, true);
+        int32_t sts = llama_decode(m_draft_llama_ctx, m_batch);
+        OPENVINO_ASSERT(sts == 0, "llama_cpp_plugin: llama_decode failed for the draft model with code ", sts);
+        m_draft_tokens.push_back(LogitsSampler::get_greedy_token(llama_get_logits_ith(m_draft_llama_ctx, 0), n_vocab));
+    }
+}
+
+void LlamaCppSyncInferRequest::decode_speculatively(const InferTask& task, size_t begin) {
+    propose_draft_tokens(task);
+
+    // all but the last input token are processed as usual, without any outputs
+    size_t last_idx = task.sequence_length - 1;
+    if (begin < last_idx) {
+        decode_chunked(task, begin, last_idx);
+    }
+
+    // The last input token and all of the draft tokens are verified in a single batch: the i-th draft token is
+    // accepted if it is what the main model predicts after the preceding (input or accepted draft) token.
+    size_t n_draft = m_draft_tokens.size();
+    llama_pos last_pos = task.get_position(last_idx);
+    reserve_batch(n_draft + 1);
+    llama_batch_add_reimpl(m_batch, task.input_ids[last_idx], last_pos, m_first_seq_id, true);
+    for (size_t i = 0; i < n_draft; i++) {
+        llama_pos pos = last_pos + 1 + static_cast<llama_pos>(i);
+        llama_batch_add_reimpl(m_batch, m_draft_tokens[i], pos, m_first_seq_id, true);
+    }
+    int32_t sts = llama_decode(m_llama_ctx, m_batch);
+    if (sts != 0) {
+        OPENVINO_THROW("llama_decode failed with code ", sts);
+    }
+    extract_logits(task, last_idx, last_idx + 1, 0);
+
+    size_t n_vocab = llama_n_vocab(m_compiled_model_ptr->m_llama_model_ptr);
+    size_t n_accepted = 0;
+    llama_token next_token = LogitsSampler::get_greedy_token(llama_get_logits_ith(m_llama_ctx, 0), n_vocab);
+    while (n_accepted < n_draft && m_draft_tokens[n_accepted] == next_token) {
+        n_accepted++;
+        const float* logits = llama_get_logits_ith(m_llama_ctx, static_cast<int32_t>(n_accepted));
+        next_token = LogitsSampler::get_greedy_token(logits, n_vocab);
+    }
+
+    // Rollback of the rejected tokens. The draft model has not processed its own last proposal yet, which has to be
+    // done if that was accepted as well, so that both KV caches hold the same history.
+    llama_pos first_rejected_pos = last_pos + 1 + static_cast<llama_pos>(n_accepted);
+    llama_kv_cache_seq_rm(m_llama_ctx, m_first_seq_id, first_rejected_pos, -1);
+    llama_kv_cache_seq_rm(m_draft_llama_ctx, 0, first_rejected_pos, -1);
+    if (n_accepted == n_draft) {
+        reserve_batch(1);
+        llama_batch_add_reimpl(m_batch, m_draft_tokens.back(), first_rejected_pos - 1, 0, false);
+        sts = llama_decode(m_draft_llama_ctx, m_batch);
+        OPENVINO_ASSERT(sts == 0, "llama_cpp_plugin: llama_decode failed for the draft model with code ", sts);
+    }
+
+    const auto& output = get_outputs().back();  // speculative_token_ids is always the last output
+    int64_t* speculative_token_ids =
+        allocate_output(output, ov::element::Type_t::i64, {1, n_accepted + 1})->data<int64_t>();
+    std::copy(m_draft_tokens.begin(), m_draft_tokens.begin() + n_accepted, speculative_token_ids);
+    speculative_token_ids[n_accepted] = next_token;
+}
+
+void LlamaCppSyncInferRequest::shift_context(const InferTask& task) {
+    const Config& config = m_compiled_model_ptr->m_config;
+    if (!config.context_shift) {
+        return;
+    }
+    // the draft tokens of the speculative decoding occupy the cells of the main context during their verification
+    size_t n_new_cells = task.batch_size * task.sequence_length;
+    if (m_draft_llama_ctx != nullptr) {
+        n_new_cells += config.num_draft_tokens;
+    }
+    const size_t n_ctx = llama_n_ctx(m_llama_ctx);
+    const llama_pos n_keep = static_cast<llama_pos>(config.context_shift_sink_tokens);
+
+    while (static_cast<size_t>(llama_get_kv_cache_used_cells(m_llama_ctx)) + n_new_cells > n_ctx) {
+        // all of the sequences are expected to be at the same position, as is the case in the batched generation
+        llama_pos n_past = static_cast<llama_pos>(task.position_ids[0] - m_sequence_info.position_offset);
+        llama_pos n_discard = (n_past - n_keep) / 2;
+        OPENVINO_ASSERT(n_discard > 0,
+                        "llama_cpp_plugin: ",
+                        n_new_cells,
+                        " new tokens do not fit into the context of ",
+                        n_ctx,
+                        " tokens even after shifting it");
+        for (size_t seq_idx = 0; seq_idx < task.batch_size; seq_idx++) {
+            llama_seq_id seq_id = m_first_seq_id + static_cast<llama_seq_id>(seq_idx);
+            llama_kv_cache_seq_rm(m_llama_ctx, seq_id, n_keep, n_keep + n_discard);
+            llama_kv_cache_seq_add(m_llama_ctx, seq_id, n_keep + n_discard, n_past, -n_discard);
+        }
+        if (m_draft_llama_ctx != nullptr) {
+            llama_kv_cache_seq_rm(m_draft_llama_ctx, 0, n_keep, n_keep + n_discard);
+            llama_kv_cache_seq_add(m_draft_llama_ctx, 0, n_keep + n_discard, n_past, -n_discard);
+        }
+        m_sequence_info.position_offset += n_discard;
+    }
+}
+
+size_t LlamaCppSyncInferRequest::apply_prefix_cache(const InferTask& task) {
+    PrefixCache* prefix_cache = m_compiled_model_ptr->m_prefix_cache.get();
+    // The cached states only hold the KV cache, not the per-token logits of the prefix, and can only be restored into
+    // an empty context of a single-sequence request (which a context shared between the requests never is)
+    if (prefix_cache == nullptr || m_scheduler != nullptr || task.batch_size != 1 || task.n_output_tokens != 1 ||
+        llama_get_kv_cache_used_cells(m_llama_ctx) != 0 || task.position_ids[0] != 0 ||
+        task.attention_mask != nullptr) {
+        return 0;
+    }
+
+    size_t restored_length = prefix_cache->restore(m_llama_ctx, task.input_ids, task.sequence_length);
+    if (restored_length != 0) {
+        return restored_length;
+    }
+
+    size_t prefix_length = prefix_cache->get_prefix_length_to_store(task.input_ids, task.sequence_length);
+    if (prefix_length != 0) {
+        decode_chunked(task, 0, prefix_length);
+        prefix_cache->store(m_llama_ctx, task.input_ids, prefix_length);
+    }
+    return prefix_length;
+}
+
 void LlamaCppSyncInferRequest::infer() {
+    // the worker threads spawned by llama.cpp for the graph computation inherit the affinity of this thread
+    std::unique_ptr<ScopedCpuAffinity> cpu_affinity;
+    if (m_cpu_partitioner != nullptr && m_compiled_model_ptr->m_config.enable_cpu_pinning) {
+        cpu_affinity.reset(new ScopedCpuAffinity(m_cpu_partitioner->get_cpus(m_cpu_partition_idx)));
+    }
+
     auto input_ids_tensor_ptr = get_tensor(get_inputs()[0]);     // TODO (vshampor) correctly identify input_ids among
                                                                  // all inputs without hardcode
                                                                  //
@@ -80,70 +484,206 @@ void LlamaCppSyncInferRequest::infer() {
     OPENVINO_ASSERT(input_ids_tensor_ptr->get_shape().size() == 2);
     size_t batch_size = input_ids_tensor_ptr->get_shape()[0];
     size_t sequence_length = input_ids_tensor_ptr->get_shape()[1];
+    OPENVINO_ASSERT(m_scheduler == nullptr || batch_size <= LlamaCppScheduler::SEQUENCES_PER_REQUEST / 2,
+                    "llama_cpp_plugin: batch size ",
+                    batch_size,
+                    " is too large for continuous batching");
 
-    llama_batch batch = llama_batch_init(sequence_length * batch_size, /* embd = */ 0, /* n_seq_max = */ batch_size);
-    const int64_t* data_ptr = input_ids_tensor_ptr->data<int64_t>();
-
-    const int64_t* sequence_start_ptr = data_ptr /* + seq_idx */;
+    auto beam_idx_tensor_ptr = get_tensor(get_inputs()[3]);  // TODO (vshampor) correctly identify beam_idx among
+                                                             // all inputs without hardcode
+    reorder_kv_cache(beam_idx_tensor_ptr, batch_size);
+    m_sequence_info.num_sequences = batch_size;
 
-    const int64_t* position_idx_ptr = position_ids_tensor_ptr->data<int64_t>();
+    const bool use_llama_timings = m_compiled_model_ptr->m_config.enable_profiling && m_scheduler == nullptr;
+    m_profiling_stats = ProfilingStats();
+    if (use_llama_timings) {
+        llama_reset_timings(m_llama_ctx);
+    }
 
-    int num_sequences = batch_size;
+    InferTask task;
+    task.input_ids = input_ids_tensor_ptr->data<int64_t>();
+    task.position_ids = position_ids_tensor_ptr->data<int64_t>();
+    task.batch_size = batch_size;
+    task.sequence_length = sequence_length;
+    task.n_output_tokens = m_compiled_model_ptr->m_config.logits_last_token_only ? 1 : sequence_length;
+    if (m_compiled_model_ptr->m_config.embeddings && m_compiled_model_ptr->m_config.pooling_type != "none") {
+        task.n_output_tokens = sequence_length;  // all of the tokens are pooled
+    }
 
-    for (int seq_idx = 0; seq_idx < num_sequences; seq_idx++) {
-        for (size_t tok_idx = 0; tok_idx < sequence_length; ++tok_idx) {
-            const int64_t token_id = sequence_start_ptr[seq_idx * sequence_length + tok_idx];
-            const int64_t position_id = position_idx_ptr[seq_idx * sequence_length + tok_idx];
-            llama_batch_add_reimpl(batch,
-                                   token_id,
-                                   position_id,
-                                   {seq_idx},
-                                   true);  // the last `true` here is a marker that the logits for this
-                                           // token should be computed and returned
+    // The columns of attention_mask past the processed history correspond to the current input tokens; the masked
+    // (padding) tokens are skipped. A mask of all ones is equivalent to no mask at all, and is not looked at further.
+    auto attention_mask_tensor_ptr = get_tensor(get_inputs()[1]);
+    if (attention_mask_tensor_ptr->get_size() != 0) {
+        const ov::Shape& mask_shape = attention_mask_tensor_ptr->get_shape();
+        OPENVINO_ASSERT(attention_mask_tensor_ptr->get_element_type() == ov::element::Type_t::i64);
+        OPENVINO_ASSERT(mask_shape.size() == 2 && mask_shape[0] == batch_size && mask_shape[1] >= sequence_length,
+                        "llama_cpp_plugin: attention_mask shape ",
+                        mask_shape,
+                        " does not match the input_ids shape ",
+                        input_ids_tensor_ptr->get_shape());
+        // only the columns of the current tokens are looked at, as in InferTask::is_padding, so that the padding of
+        // the history does not make the subsequent inputs padded
+        const int64_t* mask = attention_mask_tensor_ptr->data<int64_t>();
+        bool has_padding = false;
+        for (size_t seq_idx = 0; seq_idx < batch_size && !has_padding; seq_idx++) {
+            const int64_t* row_end = mask + (seq_idx + 1) * mask_shape[1];
+            has_padding = std::find(row_end - sequence_length, row_end, 0) != row_end;
+        }
+        if (has_padding) {
+            OPENVINO_ASSERT(m_draft_llama_ctx == nullptr,
+                            "llama_cpp_plugin: padded inputs are not supported with speculative decoding");
+            task.attention_mask = mask;
+            task.attention_mask_length = mask_shape[1];
         }
     }
-
-    int32_t sts = llama_decode(m_llama_ctx, batch);
-
-    if (sts != 0) {
-        OPENVINO_THROW("llama_decode failed with code ", sts);
+    if (m_draft_llama_ctx != nullptr) {
+        OPENVINO_ASSERT(batch_size == 1, "llama_cpp_plugin: speculative decoding only supports the batch size of 1");
+        task.n_output_tokens = 1;  // the verification batch only yields the logits of the last input token
     }
 
+    // The outputs are written directly into the output tensors exactly once. The tensors themselves persist across
+    // infer() calls and are only reallocated if their capacity is insufficient for the current shape.
     size_t n_vocab = llama_n_vocab(m_compiled_model_ptr->m_llama_model_ptr);
+    size_t n_embd = llama_n_embd(m_compiled_model_ptr->m_llama_model_ptr);
+    size_t top_k = m_compiled_model_ptr->m_config.top_k_output;
+    for (const auto& output : get_outputs()) {
+        const std::string& name = output.get_any_name();
+        if (name == "logits") {
+            task.logits = allocate_output(output, ov::element::Type_t::f32, {batch_size, task.n_output_tokens, n_vocab})
+                              ->data<float>();
+        } else if (name == "greedy_token_ids") {
+            task.greedy_token_ids =
+                allocate_output(output, ov::element::Type_t::i64, {batch_size, task.n_output_tokens})->data<int64_t>();
+        } else if (name == "top_k_token_ids") {
+            task.top_k_token_ids =
+                allocate_output(output, ov::element::Type_t::i64, {batch_size, task.n_output_tokens, top_k})
+                    ->data<int64_t>();
+        } else if (name == "top_k_probs") {
+            task.top_k_probs =
+                allocate_output(output, ov::element::Type_t::f32, {batch_size, task.n_output_tokens, top_k})
+                    ->data<float>();
+        } else if (name == "sampled_token_ids") {
+            task.sampled_token_ids =
+                allocate_output(output, ov::element::Type_t::i64, {batch_size, task.n_output_tokens})->data<int64_t>();
+        } else if (name == "last_hidden_state") {
+            task.hidden_states =
+                allocate_output(output, ov::element::Type_t::f32, {batch_size, task.n_output_tokens, n_embd})
+                    ->data<float>();
+        } else if (name == "embeddings") {
+            auto embeddings_tensor_ptr = allocate_output(output, ov::element::Type_t::f32, {batch_size, n_embd});
+            task.embeddings = embeddings_tensor_ptr->data<float>();
+            std::fill_n(task.embeddings, embeddings_tensor_ptr->get_size(), 0.0f);
+            m_num_pooled_tokens.assign(batch_size, 0);
+        }
+    }
 
-    ov::Tensor output_tensor{ov::element::Type_t::f32, {batch_size, sequence_length, n_vocab}};
-    float* output_tensor_data_ptr = output_tensor.data<float>();
+    if (m_scheduler == nullptr && llama_get_kv_cache_used_cells(m_llama_ctx) == 0) {
+        m_sequence_info.position_offset = 0;  // the history was reset
+    }
+    shift_context(task);
+    task.position_offset = m_sequence_info.position_offset;
 
-    for (size_t batch_idx = 0; batch_idx < batch_size; batch_idx++) {
-        for (size_t seq_idx = 0; seq_idx < sequence_length; seq_idx++) {
-            size_t pos = batch_idx * sequence_length + seq_idx;
-            float* logits_from_llama = llama_get_logits_ith(m_llama_ctx, pos);
-            std::copy(logits_from_llama, logits_from_llama + n_vocab, output_tensor_data_ptr + pos * n_vocab);
+    size_t first_token_idx = apply_prefix_cache(task);
+    if (m_draft_llama_ctx != nullptr) {
+        decode_speculatively(task, first_token_idx);
+    } else {
+        decode_chunked(task, first_token_idx, batch_size * sequence_length);
+    }
+    if (task.embeddings != nullptr && m_compiled_model_ptr->m_config.pooling_type == "mean") {
+        size_t n_embd = llama_n_embd(m_compiled_model_ptr->m_llama_model_ptr);
+        for (size_t seq_idx = 0; seq_idx < batch_size; seq_idx++) {
+            if (m_num_pooled_tokens[seq_idx] != 0) {
+                float* pooled = task.embeddings + seq_idx * n_embd;
+                float scale = 1.0f / m_num_pooled_tokens[seq_idx];
+                std::transform(pooled, pooled + n_embd, pooled, [scale](float value) {
+                    return value * scale;
+                });
+            }
         }
     }
 
-    auto& logit_output = get_outputs()[0];
-    allocate_tensor(logit_output, [&output_tensor](ov::SoPtr<ov::ITensor>& tensor) {
-        allocate_tensor_impl(tensor, output_tensor.get_element_type(), output_tensor.get_shape());
-        output_tensor.copy_to(ov::make_tensor(tensor));
-    });
-
-    llama_batch_free(batch);
+    if (use_llama_timings) {
+        // a private context has llama.cpp's own timings of the graph evaluation, which exclude the time spent waiting
+        // on the scheduling and the logits extraction. The token counts are reported as at least 1, so they are only
+        // taken for the stages which have run.
+        llama_timings timings = llama_get_timings(m_llama_ctx);
+        if (m_profiling_stats.prompt_eval.executed) {
+            m_profiling_stats.prompt_eval.time =
+                std::chrono::nanoseconds(static_cast<int64_t>(timings.t_p_eval_ms * 1e6));
+            m_profiling_stats.n_prompt_tokens = timings.n_p_eval;
+        }
+        if (m_profiling_stats.token_eval.executed) {
+            m_profiling_stats.token_eval.time = std::chrono::nanoseconds(static_cast<int64_t>(timings.t_eval_ms * 1e6));
+            m_profiling_stats.n_eval_tokens = timings.n_eval;
+        }
+    }
 };
+
+ov::ProfilingInfo make_profiling_info(const std::string& stage_name,
+                                      std::chrono::nanoseconds time,
+                                      bool executed,
+                                      const std::string& exec_type) {
+    ov::ProfilingInfo info;
+    info.status = executed ? ov::ProfilingInfo::Status::EXECUTED : ov::ProfilingInfo::Status::NOT_RUN;
+    info.real_time = std::chrono::duration_cast<std::chrono::microseconds>(time);
+    info.cpu_time = info.real_time;
+    info.node_name = stage_name;
+    info.node_type = stage_name;
+    info.exec_type = exec_type;
+    return info;
+}
+
+std::string get_throughput_exec_type(size_t n_tokens, std::chrono::nanoseconds time) {
+    double tokens_per_second = time.count() > 0 ? n_tokens * 1e9 / time.count() : 0.0;
+    return "llama_cpp n_tokens=" + std::to_string(n_tokens) + " tokens_per_second=" + std::to_string(tokens_per_second);
+}
+
 std::vector<ov::ProfilingInfo> LlamaCppSyncInferRequest::get_profiling_info() const {
     OPENVINO_DEBUG("llama_cpp_plugin: get_profiling_info() called\n");
-    return std::vector<ov::ProfilingInfo>{};
+    if (!m_compiled_model_ptr->m_config.enable_profiling) {
+        return std::vector<ov::ProfilingInfo>{};
+    }
+    const ProfilingStats& stats = m_profiling_stats;
+    return {make_profiling_info("BatchBuilding",
+                                stats.batch_building.time,
+                                stats.batch_building.executed,
+                                "wall_clock"),
+            make_profiling_info("PromptEval",
+                                stats.prompt_eval.time,
+                                stats.prompt_eval.executed,
+                                get_throughput_exec_type(stats.n_prompt_tokens, stats.prompt_eval.time)),
+            make_profiling_info("TokenEval",
+                                stats.token_eval.time,
+                                stats.token_eval.executed,
+                                get_throughput_exec_type(stats.n_eval_tokens, stats.token_eval.time)),
+            make_profiling_info("LogitsExtraction",
+                                stats.logits_extraction.time,
+                                stats.logits_extraction.executed,
+                                "wall_clock")};
 };
 
 std::vector<ov::SoPtr<ov::IVariableState>> LlamaCppSyncInferRequest::query_state() const {
     OPENVINO_DEBUG("llama_cpp_plugin: query_state() called\n");
-    return {std::static_pointer_cast<ov::IVariableState>(std::make_shared<LlamaCppState>(m_llama_ctx))};
+    auto state =
+        std::make_shared<LlamaCppState>(m_llama_ctx, m_scheduler, m_first_seq_id, m_draft_llama_ctx, &m_sequence_info);
+    return {std::static_pointer_cast<ov::IVariableState>(state)};
 }
 
 LlamaCppSyncInferRequest::~LlamaCppSyncInferRequest() {
-    if (m_llama_ctx != nullptr) {
+    if (m_batch_capacity != 0) {
+        llama_batch_free(m_batch);
+    }
+    if (m_scheduler != nullptr) {
+        m_scheduler->release_sequences(m_first_seq_id);
+    } else if (m_llama_ctx != nullptr) {
         llama_free(m_llama_ctx);
     }
+    if (m_draft_llama_ctx != nullptr) {
+        llama_free(m_draft_llama_ctx);
+    }
+    if (m_cpu_partitioner != nullptr) {
+        m_cpu_partitioner->release_partition(m_cpu_partition_idx);
+    }
 }
 }  // namespace llama_cpp_plugin
 }  // namespace ov
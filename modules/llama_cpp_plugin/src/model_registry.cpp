@@ -0,0 +1,77 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "model_registry.hpp"
+
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "openvino/core/except.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/log.hpp"
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+namespace {
+// absolute GGUF path and the model parameters affecting the loaded weights
+using ModelKey = std::tuple<std::string, int32_t, int32_t, bool, bool>;
+
+std::mutex registry_mutex;
+std::map<ModelKey, std::weak_ptr<llama_model>> loaded_models;
+size_t backend_users = 0;
+
+// Must be called with registry_mutex locked. The backend is initialized and freed under registry_mutex as well, so that
+// a model loaded concurrently with the release of the last one never sees a backend being freed.
+std::shared_ptr<void> acquire_backend() {
+    if (backend_users++ == 0) {
+        llama_backend_init();
+    }
+    return std::shared_ptr<void>(nullptr, [](void*) {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        if (--backend_users == 0) {
+            llama_backend_free();
+        }
+    });
+}
+}  // namespace
+
+std::shared_ptr<llama_model> acquire_llama_model(const std::string& gguf_fname, const llama_model_params& mparams) {
+    ModelKey key{ov::util::get_absolute_file_path(gguf_fname),
+                 mparams.n_gpu_layers,
+                 mparams.main_gpu,
+                 mparams.use_mmap,
+                 mparams.use_mlock};
+
+    // declared before the lock: if the loading fails, the backend is released by the deleter locking registry_mutex
+    std::shared_ptr<void> backend;
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto it = loaded_models.find(key);
+    if (it != loaded_models.end()) {
+        std::shared_ptr<llama_model> model = it->second.lock();
+        if (model) {
+            OPENVINO_DEBUG("llama_cpp_plugin: reusing already loaded model for ", gguf_fname, "\n");
+            return model;
+        }
+    }
+
+    backend = acquire_backend();
+    llama_model* model_ptr = llama_load_model_from_file(gguf_fname.c_str(), mparams);
+    OPENVINO_ASSERT(model_ptr != nullptr, "llama_cpp_plugin: failed to load model from ", gguf_fname);
+
+    // the backend reference is held by the deleter, so that the backend outlives all the models
+    std::shared_ptr<llama_model> model(model_ptr, [backend, key](llama_model* ptr) {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        llama_free_model(ptr);
+        auto it = loaded_models.find(key);
+        if (it != loaded_models.end() && it->second.expired()) {
+            loaded_models.erase(it);
+        }
+    });
+    loaded_models[key] = model;
+    return model;
+}
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
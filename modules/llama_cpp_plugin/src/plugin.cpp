@@ -6,14 +6,21 @@
 #include <openvino/runtime/properties.hpp>
 
 #include "compiled_model.hpp"
+#include "cpu_partitioner.hpp"
+#include "gguf_converter.hpp"
+#include "gguf_manifest.hpp"
+#include "llama_cpp/properties.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/runtime/internal_properties.hpp"
+#include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/util/log.hpp"
 
 namespace {
 static constexpr const char* wait_executor_name = "LlamaCppWaitExecutor";
 static constexpr const char* stream_executor_name = "LlamaCppStreamsExecutor";
 static constexpr const char* template_exclusive_executor = "LlamaCppExecutor";
+// the IRs do not carry the maximum sequence length the model was trained for
+static constexpr uint32_t default_converted_context_length = 4096;
 }  // namespace
 
 namespace ov {
@@ -23,44 +30,43 @@ LlamaCppPlugin::LlamaCppPlugin() : IPlugin() {
 }
 std::shared_ptr<ov::ICompiledModel> LlamaCppPlugin::compile_model(const std::shared_ptr<const ov::Model>& model,
                                                                   const ov::AnyMap& properties) const {
-    OPENVINO_THROW_NOT_IMPLEMENTED("Currently only direct GGUF file loading is "
-                                   "supported for the LLAMA_CPP* plugins");
+    Config config(properties, m_config, /* throw_on_unsupported = */ false);
+    auto gguf_file = std::make_shared<TemporaryGgufFile>();
+    uint32_t context_length = config.context_size != 0 ? config.context_size : default_converted_context_length;
+    convert_model_to_gguf(model, gguf_file->get_path(), config.conversion_weights_type, context_length);
+    return std::make_shared<LlamaCppModel>(gguf_file, shared_from_this(), create_task_executor(config), config);
 }
 
 std::shared_ptr<ov::ICompiledModel> LlamaCppPlugin::compile_model(const std::shared_ptr<const ov::Model>& model,
                                                                   const ov::AnyMap& properties,
                                                                   const ov::SoPtr<ov::IRemoteContext>& context) const {
-    OPENVINO_THROW_NOT_IMPLEMENTED("Currently only direct GGUF file loading is "
-                                   "supported for the LLAMA_CPP* plugins");
+    OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: remote contexts are not supported");
 }
 std::shared_ptr<ov::ICompiledModel> LlamaCppPlugin::compile_model(const std::string& fname,
                                                                   const ov::AnyMap& properties) const {
-    size_t num_threads = 0;
-    auto it = properties.find(ov::inference_num_threads.name());
-    if (it != properties.end()) {
-        num_threads = it->second.as<int>();
-        OPENVINO_ASSERT(num_threads >= 0, "INFERENCE_NUM_THREADS cannot be negative");
-    } else {
-        num_threads = m_num_threads;
+    Config config(properties, m_config, /* throw_on_unsupported = */ false);
+    return std::make_shared<LlamaCppModel>(fname, shared_from_this(), create_task_executor(config), config);
+}
+
+std::shared_ptr<ov::threading::ITaskExecutor> LlamaCppPlugin::create_task_executor(Config& config) const {
+    if (config.num_streams <= 0) {
+        // AUTO and NUMA both result in a stream per NUMA node
+        config.num_streams = static_cast<int32_t>(CpuPartitioner::get_numa_node_cpus().size());
     }
-    return std::make_shared<LlamaCppModel>(fname, shared_from_this(), num_threads);
+    return get_executor_manager()->get_idle_cpu_streams_executor(
+        ov::threading::IStreamsExecutor::Config(stream_executor_name, config.num_streams));
 }
 
 void LlamaCppPlugin::set_property(const ov::AnyMap& properties) {
-    for (const auto& map_entry : properties) {
-        if (ov::inference_num_threads == map_entry.first) {
-            int num_threads = map_entry.second.as<int>();
-            OPENVINO_ASSERT(num_threads >= 0, "INFERENCE_NUM_THREADS cannot be negative");
-            m_num_threads = num_threads;
-        }
-        OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: setting property ", map_entry.first, "not implemented");
-    }
+    m_config.set_property(properties);
 }
 
 ov::Any LlamaCppPlugin::get_property(const std::string& name, const ov::AnyMap& arguments) const {
     if (ov::supported_properties == name) {
-        return decltype(ov::supported_properties)::value_type(
-            std::vector<PropertyName>({ov::device::capabilities, ov::device::full_name, ov::inference_num_threads}));
+        std::vector<PropertyName> supported_properties = {ov::device::capabilities, ov::device::full_name};
+        auto config_properties = Config::get_supported_properties();
+        supported_properties.insert(supported_properties.end(), config_properties.begin(), config_properties.end());
+        return decltype(ov::supported_properties)::value_type(supported_properties);
     }
     if (ov::device::capabilities == name) {
         return decltype(ov::device::capabilities)::value_type(
@@ -72,18 +78,17 @@ ov::Any LlamaCppPlugin::get_property(const std::string& name, const ov::AnyMap&
     }
 
     if (ov::internal::caching_properties == name) {
-        return std::vector<ov::PropertyName>{ov::device::full_name};
+        // the GGUF file converted from an IR, which the cache entry embeds, depends on these as well
+        return std::vector<ov::PropertyName>{ov::device::full_name,
+                                             ov::llama_cpp::conversion_weights_type,
+                                             ov::llama_cpp::context_size};
     }
 
     if (ov::device::full_name == name) {
         return std::string("LLAMA_CPP");
     }
 
-    if (ov::inference_num_threads == name) {
-        return m_num_threads;
-    }
-
-    OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: getting property ", name, "not implemented");
+    return m_config.get_property(name);
 }
 
 ov::SoPtr<ov::IRemoteContext> LlamaCppPlugin::create_context(const ov::AnyMap& remote_properties) const {
@@ -94,7 +99,17 @@ ov::SoPtr<ov::IRemoteContext> LlamaCppPlugin::get_default_context(const ov::AnyM
 }
 std::shared_ptr<ov::ICompiledModel> LlamaCppPlugin::import_model(std::istream& model_file_stream,
                                                                  const ov::AnyMap& properties) const {
-    OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: model importing not implemented");
+    std::shared_ptr<TemporaryGgufFile> gguf_file = read_embedded_gguf(model_file_stream);
+    if (gguf_file) {
+        OPENVINO_DEBUG("llama_cpp_plugin: importing model from the embedded GGUF file\n");
+        Config config(properties, m_config, /* throw_on_unsupported = */ false);
+        return std::make_shared<LlamaCppModel>(gguf_file, shared_from_this(), create_task_executor(config), config);
+    }
+    GgufManifest manifest = GgufManifest::read(model_file_stream);
+    manifest.validate();
+    OPENVINO_DEBUG("llama_cpp_plugin: importing model from cached GGUF manifest for ", manifest.path, "\n");
+    Config config(properties, m_config, /* throw_on_unsupported = */ false);
+    return std::make_shared<LlamaCppModel>(manifest.path, shared_from_this(), create_task_executor(config), config);
 }
 
 std::shared_ptr<ov::ICompiledModel> LlamaCppPlugin::import_model(std::istream& model,
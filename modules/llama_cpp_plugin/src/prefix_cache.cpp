@@ -0,0 +1,114 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "prefix_cache.hpp"
+
+#include <algorithm>
+
+#include "openvino/util/log.hpp"
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+namespace {
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+uint64_t hash_tokens(uint64_t hash, const int64_t* tokens, size_t n_tokens) {
+    for (size_t i = 0; i < n_tokens; i++) {
+        hash ^= static_cast<uint64_t>(tokens[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+}  // namespace
+
+PrefixCache::PrefixCache(size_t capacity, size_t min_prefix_length)
+    : m_capacity(capacity),
+      m_min_prefix_length(min_prefix_length) {}
+
+size_t PrefixCache::restore(llama_context* ctx, const int64_t* tokens, size_t n_tokens) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // the prefix hashes of the prompt are computed incrementally, so that each entry is checked in O(1)
+    std::vector<uint64_t> prefix_hashes(n_tokens);
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < n_tokens; i++) {
+        hash = hash_tokens(hash, tokens + i, 1);
+        prefix_hashes[i] = hash;
+    }
+
+    auto best_it = m_entries.end();
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        size_t len = it->tokens.size();
+        if (len >= n_tokens || prefix_hashes[len - 1] != it->hash ||
+            !std::equal(it->tokens.begin(), it->tokens.end(), tokens)) {
+            continue;
+        }
+        if (best_it == m_entries.end() || len > best_it->tokens.size()) {
+            best_it = it;
+        }
+    }
+    if (best_it == m_entries.end()) {
+        return 0;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, best_it);
+    llama_set_state_data(ctx, best_it->state.data());
+    OPENVINO_DEBUG("llama_cpp_plugin: restored ", best_it->tokens.size(), " prompt tokens from the prefix cache\n");
+    return best_it->tokens.size();
+}
+
+size_t PrefixCache::get_prefix_length_to_store(const int64_t* tokens, size_t n_tokens) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    size_t longest_common_prefix = 0;
+    for (const auto& seen_prompt : m_seen_prompts) {
+        size_t max_len = std::min(seen_prompt.size(), n_tokens);
+        size_t len = std::mismatch(seen_prompt.begin(), seen_prompt.begin() + max_len, tokens).first -
+                     seen_prompt.begin();
+        longest_common_prefix = std::max(longest_common_prefix, len);
+    }
+
+    m_seen_prompts.emplace_front(tokens, tokens + n_tokens);
+    if (m_seen_prompts.size() > m_capacity) {
+        m_seen_prompts.pop_back();
+    }
+
+    // at least one token must remain to be processed after the prefix to produce the logits
+    longest_common_prefix = std::min(longest_common_prefix, n_tokens - 1);
+    return longest_common_prefix >= m_min_prefix_length ? longest_common_prefix : 0;
+}
+
+void PrefixCache::store(llama_context* ctx, const int64_t* tokens, size_t n_tokens) {
+    Entry entry;
+    entry.hash = hash_tokens(FNV_OFFSET_BASIS, tokens, n_tokens);
+    entry.tokens.assign(tokens, tokens + n_tokens);
+
+    {
+        // llama_get_state_size reports the upper bound for the whole KV cache, while only the used cells are written,
+        // so the state is serialized into a scratch buffer reused by all the stores and only its used part is kept
+        std::lock_guard<std::mutex> scratch_lock(m_scratch_mutex);
+        size_t max_state_size = llama_get_state_size(ctx);
+        if (m_scratch_size < max_state_size) {
+            // not value-initialized, so that the pages of the buffer which are never written are not committed
+            m_scratch.reset(new uint8_t[max_state_size]);
+            m_scratch_size = max_state_size;
+        }
+        size_t state_size = llama_copy_state_data(ctx, m_scratch.get());
+        entry.state.assign(m_scratch.get(), m_scratch.get() + state_size);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& existing_entry : m_entries) {
+        if (existing_entry.hash == entry.hash && existing_entry.tokens == entry.tokens) {
+            return;  // another infer request has stored the same prefix concurrently
+        }
+    }
+    m_entries.push_front(std::move(entry));
+    if (m_entries.size() > m_capacity) {
+        m_entries.pop_back();
+    }
+}
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
@@ -0,0 +1,91 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+LogitsSampler::LogitsSampler(float temperature, float top_p, uint32_t seed)
+    : m_temperature(temperature),
+      m_top_p(top_p),
+      m_generator(seed) {}
+
+int64_t LogitsSampler::get_greedy_token(const float* logits, size_t n_vocab) {
+    return std::max_element(logits, logits + n_vocab) - logits;
+}
+
+void LogitsSampler::get_top_k_tokens(const float* logits, size_t n_vocab, size_t k, int64_t* token_ids, float* probs) {
+    k = std::min(k, n_vocab);
+    m_candidates.resize(n_vocab);
+    float max_logit = logits[0];
+    for (size_t i = 0; i < n_vocab; i++) {
+        m_candidates[i] = std::make_pair(logits[i], static_cast<int32_t>(i));
+        max_logit = std::max(max_logit, logits[i]);
+    }
+    float sum = 0.0f;
+    for (size_t i = 0; i < n_vocab; i++) {
+        sum += std::exp(logits[i] - max_logit);
+    }
+
+    std::partial_sort(m_candidates.begin(),
+                      m_candidates.begin() + k,
+                      m_candidates.end(),
+                      std::greater<std::pair<float, int32_t>>());
+    for (size_t i = 0; i < k; i++) {
+        token_ids[i] = m_candidates[i].second;
+        probs[i] = std::exp(m_candidates[i].first - max_logit) / sum;
+    }
+}
+
+int64_t LogitsSampler::sample_token(const float* logits, size_t n_vocab) {
+    float max_logit = *std::max_element(logits, logits + n_vocab);
+    m_candidates.resize(n_vocab);
+    float sum = 0.0f;
+    for (size_t i = 0; i < n_vocab; i++) {
+        float weight = std::exp((logits[i] - max_logit) / m_temperature);
+        m_candidates[i] = std::make_pair(weight, static_cast<int32_t>(i));
+        sum += weight;
+    }
+
+    // The nucleus is only determined (by sorting) if it is restricted; otherwise the unnormalized weights are sampled
+    // from in the vocabulary order. The nucleus is usually a small fraction of the vocabulary, so the candidates are
+    // sorted in windows of a growing size until the cumulative probability is reached, instead of sorting all of them.
+    size_t n_candidates = n_vocab;
+    if (m_top_p < 1.0f) {
+        const float nucleus_weight = m_top_p * sum;
+        float cumulative = 0.0f;
+        size_t n_sorted = 0;
+        size_t window = std::min<size_t>(64, n_vocab);
+        for (n_candidates = 0; n_candidates < n_vocab && cumulative < nucleus_weight;) {
+            if (n_candidates == n_sorted) {
+                // the sorted prefix holds the largest weights, so only the rest of the candidates is searched
+                std::partial_sort(m_candidates.begin() + n_sorted,
+                                  m_candidates.begin() + window,
+                                  m_candidates.end(),
+                                  std::greater<std::pair<float, int32_t>>());
+                n_sorted = window;
+                window = std::min(window * 2, n_vocab);
+            }
+            cumulative += m_candidates[n_candidates++].first;
+        }
+        sum = cumulative;
+    }
+
+    float threshold = std::uniform_real_distribution<float>(0.0f, sum)(m_generator);
+    float cumulative = 0.0f;
+    for (size_t i = 0; i < n_candidates; i++) {
+        cumulative += m_candidates[i].first;
+        if (threshold < cumulative) {
+            return m_candidates[i].second;
+        }
+    }
+    return m_candidates[n_candidates - 1].second;  // only reachable due to the rounding errors
+}
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
@@ -0,0 +1,170 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "scheduler.hpp"
+
+#include <algorithm>
+
+#include "openvino/core/except.hpp"
+#include "openvino/util/log.hpp"
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+constexpr llama_seq_id LlamaCppScheduler::SEQUENCES_PER_REQUEST;
+
+LlamaCppScheduler::LlamaCppScheduler(llama_model* model, const llama_context_params& cparams) {
+    m_llama_ctx = llama_new_context_with_model(model, cparams);
+    OPENVINO_ASSERT(m_llama_ctx != nullptr, "llama_cpp_plugin: failed to create the shared llama.cpp context");
+    m_max_batch_tokens = llama_n_batch(m_llama_ctx);
+}
+
+LlamaCppScheduler::~LlamaCppScheduler() {
+    if (m_merged_batch_capacity != 0) {
+        llama_batch_free(m_merged_batch);
+    }
+    llama_free(m_llama_ctx);
+}
+
+llama_seq_id LlamaCppScheduler::acquire_sequences() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_free_sequence_ranges.empty()) {
+        llama_seq_id first_seq_id = m_free_sequence_ranges.back();
+        m_free_sequence_ranges.pop_back();
+        return first_seq_id;
+    }
+    llama_seq_id first_seq_id = m_next_sequence_range;
+    m_next_sequence_range += SEQUENCES_PER_REQUEST;
+    return first_seq_id;
+}
+
+void LlamaCppScheduler::release_sequences(llama_seq_id first_seq_id) {
+    clear_sequences(first_seq_id);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_free_sequence_ranges.push_back(first_seq_id);
+}
+
+void LlamaCppScheduler::clear_sequences(llama_seq_id first_seq_id) {
+    run_exclusive([first_seq_id](llama_context* ctx) {
+        for (llama_seq_id seq_id = first_seq_id; seq_id < first_seq_id + SEQUENCES_PER_REQUEST; seq_id++) {
+            llama_kv_cache_seq_rm(ctx, seq_id, -1, -1);
+        }
+    });
+}
+
+void LlamaCppScheduler::run_exclusive(const std::function<void(llama_context*)>& fn) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this] {
+        return !m_is_busy;
+    });
+    fn(m_llama_ctx);
+}
+
+void LlamaCppScheduler::reserve_merged_batch(size_t n_tokens) {
+    if (n_tokens > m_merged_batch_capacity) {
+        if (m_merged_batch_capacity != 0) {
+            llama_batch_free(m_merged_batch);
+        }
+        m_merged_batch = llama_batch_init(n_tokens, /* embd = */ 0, /* n_seq_max = */ 1);
+        m_merged_batch_capacity = n_tokens;
+    }
+    m_merged_batch.n_tokens = 0;
+}
+
+void LlamaCppScheduler::run_jobs(const std::vector<Job*>& jobs) {
+    size_t total_tokens = 0;
+    for (const Job* job : jobs) {
+        total_tokens += job->batch->n_tokens;
+    }
+    reserve_merged_batch(total_tokens);
+
+    for (const Job* job : jobs) {
+        const llama_batch& batch = *(job->batch);
+        for (int32_t i = 0; i < batch.n_tokens; i++) {
+            int32_t merged_idx = m_merged_batch.n_tokens++;
+            m_merged_batch.token[merged_idx] = batch.token[i];
+            m_merged_batch.pos[merged_idx] = batch.pos[i];
+            m_merged_batch.n_seq_id[merged_idx] = 1;
+            m_merged_batch.seq_id[merged_idx][0] = batch.seq_id[i][0];
+            m_merged_batch.logits[merged_idx] = batch.logits[i];
+        }
+    }
+
+    int32_t sts = llama_decode(m_llama_ctx, m_merged_batch);
+
+    int32_t offset = 0;
+    for (Job* job : jobs) {
+        job->status = sts;
+        if (sts == 0) {
+            try {
+                (*job->on_decoded)(offset);
+            } catch (...) {
+                job->exception = std::current_exception();
+            }
+        }
+        offset += job->batch->n_tokens;
+    }
+}
+
+void LlamaCppScheduler::decode(const llama_batch& batch, const std::function<void(int32_t)>& on_decoded) {
+    Job job;
+    job.batch = &batch;
+    job.on_decoded = &on_decoded;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_pending_jobs.push_back(&job);
+
+    while (!job.done) {
+        if (m_is_busy) {
+            m_cv.wait(lock);
+            continue;
+        }
+
+        // become the leader and take as many of the pending steps as fit into a single llama.cpp batch
+        m_is_busy = true;
+        m_running_jobs.clear();
+        size_t total_tokens = 0;
+        auto it = m_pending_jobs.begin();
+        while (it != m_pending_jobs.end()) {
+            size_t n_tokens = (*it)->batch->n_tokens;
+            if (!m_running_jobs.empty() && total_tokens + n_tokens > m_max_batch_tokens) {
+                ++it;
+                continue;
+            }
+            total_tokens += n_tokens;
+            m_running_jobs.push_back(*it);
+            it = m_pending_jobs.erase(it);
+        }
+        OPENVINO_DEBUG("llama_cpp_plugin: decoding ",
+                       m_running_jobs.size(),
+                       " merged infer request steps with ",
+                       total_tokens,
+                       " tokens\n");
+
+        lock.unlock();
+        try {
+            run_jobs(m_running_jobs);
+        } catch (...) {
+            for (Job* running_job : m_running_jobs) {
+                running_job->exception = std::current_exception();
+            }
+        }
+        lock.lock();
+
+        for (Job* running_job : m_running_jobs) {
+            running_job->done = true;
+        }
+        m_is_busy = false;
+        m_cv.notify_all();
+    }
+
+    if (job.exception) {
+        std::rethrow_exception(job.exception);
+    }
+    if (job.status != 0) {
+        OPENVINO_THROW("llama_decode failed with code ", job.status);
+    }
+}
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
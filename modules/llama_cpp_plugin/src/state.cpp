@@ -0,0 +1,122 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "state.hpp"
+
+#include <cstring>
+
+#include "openvino/runtime/make_tensor.hpp"
+
+namespace ov {
+namespace llama_cpp_plugin {
+
+namespace {
+// The serialized state starts with the sizes of the main and the draft model context states (the latter is 0 unless
+// speculative decoding is used) and the sequence info of the infer request, followed by the llama.cpp states
+// themselves.
+struct SerializedStateHeader {
+    uint64_t state_size;
+    uint64_t draft_state_size;
+    uint64_t num_sequences;
+    int64_t position_offset;
+};
+}  // namespace
+
+void LlamaCppState::reset() {
+    OPENVINO_ASSERT(m_llama_ctx_ptr != nullptr);
+    if (m_draft_llama_ctx_ptr != nullptr) {
+        llama_kv_cache_clear(m_draft_llama_ctx_ptr);
+    }
+    if (m_scheduler == nullptr) {
+        llama_kv_cache_clear(m_llama_ctx_ptr);
+        if (m_sequence_info != nullptr) {
+            *m_sequence_info = SequenceInfo();
+        }
+        return;
+    }
+    // only the sequences of this infer request may be removed from the shared context
+    m_scheduler->clear_sequences(m_first_seq_id);
+    if (m_sequence_info != nullptr) {
+        *m_sequence_info = SequenceInfo();
+    }
+}
+
+const ov::SoPtr<ov::ITensor>& LlamaCppState::get_state() const {
+    OPENVINO_ASSERT(m_llama_ctx_ptr != nullptr);
+    if (m_scheduler != nullptr) {
+        // llama.cpp can only serialize the whole context, which is shared with the other infer requests
+        OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: get_state is not supported with continuous batching");
+    }
+
+    // llama_get_state_size reports the upper bound for the whole KV cache, while only the used cells are written, so
+    // the states are serialized directly into a tensor of the maximum size, which is then shrunk to the actual size
+    size_t max_size = sizeof(SerializedStateHeader) + llama_get_state_size(m_llama_ctx_ptr);
+    if (m_draft_llama_ctx_ptr != nullptr) {
+        max_size += llama_get_state_size(m_draft_llama_ctx_ptr);
+    }
+    m_serialized_state = ov::make_tensor(ov::element::u8, ov::Shape{max_size});
+    uint8_t* dst = m_serialized_state->data<uint8_t>();
+
+    SerializedStateHeader header = {};
+    header.state_size = llama_copy_state_data(m_llama_ctx_ptr, dst + sizeof(header));
+    if (m_draft_llama_ctx_ptr != nullptr) {
+        uint8_t* draft_dst = dst + sizeof(header) + header.state_size;
+        header.draft_state_size = llama_copy_state_data(m_draft_llama_ctx_ptr, draft_dst);
+    }
+    if (m_sequence_info != nullptr) {
+        header.num_sequences = m_sequence_info->num_sequences;
+        header.position_offset = m_sequence_info->position_offset;
+    }
+    std::memcpy(dst, &header, sizeof(header));
+    // shrinking keeps the allocation, whose pages past the written data have never been touched
+    m_serialized_state->set_shape(ov::Shape{sizeof(header) + header.state_size + header.draft_state_size});
+    return m_serialized_state;
+}
+
+void LlamaCppState::set_state(const ov::SoPtr<ov::ITensor>& state) {
+    OPENVINO_ASSERT(m_llama_ctx_ptr != nullptr);
+    if (m_scheduler != nullptr) {
+        OPENVINO_THROW_NOT_IMPLEMENTED("llama_cpp_plugin: set_state is not supported with continuous batching");
+    }
+    OPENVINO_ASSERT(state->get_element_type() == ov::element::u8,
+                    "llama_cpp_plugin: the state tensor must be of the u8 type");
+
+    SerializedStateHeader header;
+    size_t size = state->get_byte_size();
+    OPENVINO_ASSERT(size >= sizeof(header), "llama_cpp_plugin: the state tensor is too small");
+    uint8_t* src = state->data<uint8_t>();
+    std::memcpy(&header, src, sizeof(header));
+    OPENVINO_ASSERT(size == sizeof(header) + header.state_size + header.draft_state_size,
+                    "llama_cpp_plugin: the state tensor size ",
+                    size,
+                    " does not match the sizes recorded in it");
+    OPENVINO_ASSERT((header.draft_state_size != 0) == (m_draft_llama_ctx_ptr != nullptr),
+                    "llama_cpp_plugin: the state was obtained with a different draft model configuration");
+    // llama_set_state_data trusts the data it reads, so a state of a larger context must be rejected before the call
+    OPENVINO_ASSERT(header.state_size <= llama_get_state_size(m_llama_ctx_ptr),
+                    "llama_cpp_plugin: the state size ",
+                    header.state_size,
+                    " exceeds the maximum state size of the context");
+    if (m_draft_llama_ctx_ptr != nullptr) {
+        OPENVINO_ASSERT(header.draft_state_size <= llama_get_state_size(m_draft_llama_ctx_ptr),
+                        "llama_cpp_plugin: the draft state size ",
+                        header.draft_state_size,
+                        " exceeds the maximum state size of the draft context");
+    }
+
+    size_t read_size = llama_set_state_data(m_llama_ctx_ptr, src + sizeof(header));
+    OPENVINO_ASSERT(read_size == header.state_size,
+                    "llama_cpp_plugin: the state is incompatible with the context of the compiled model");
+    if (m_draft_llama_ctx_ptr != nullptr) {
+        read_size = llama_set_state_data(m_draft_llama_ctx_ptr, src + sizeof(header) + header.state_size);
+        OPENVINO_ASSERT(read_size == header.draft_state_size,
+                        "llama_cpp_plugin: the state is incompatible with the context of the draft model");
+    }
+    if (m_sequence_info != nullptr) {
+        m_sequence_info->num_sequences = static_cast<size_t>(header.num_sequences);
+        m_sequence_info->position_offset = header.position_offset;
+    }
+}
+
+}  // namespace llama_cpp_plugin
+}  // namespace ov
@@ -0,0 +1,27 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LLAMA_LIKE_MODEL_HPP
+#define LLAMA_LIKE_MODEL_HPP
+
+#include <memory>
+
+#include "openvino/core/model.hpp"
+
+// Dimensions of the tiny LLaMA model with random weights, which is converted to GGUF by the plugin
+constexpr size_t N_VOCAB = 320;
+constexpr size_t N_EMBD = 64;
+constexpr size_t N_FF = 128;
+constexpr size_t N_LAYERS = 2;
+constexpr size_t N_HEAD = 4;
+constexpr size_t N_HEAD_KV = 2;
+constexpr size_t HEAD_SIZE = N_EMBD / N_HEAD;
+constexpr float RMS_NORM_EPS = 1e-5f;
+
+// Only the parts of the optimum-intel LLaMA IR that the conversion relies on: the named weights, the KV cache
+// variables and the RMS norm epsilon. The weights are the same regardless of transpose_b, which only selects whether
+// the projection matrices are stored in the [out, in] layout and multiplied with transpose_b set (as exported by
+// optimum-intel) or stored in the [in, out] layout.
+std::shared_ptr<ov::Model> make_llama_like_model(bool transpose_b = true);
+
+#endif /* LLAMA_LIKE_MODEL_HPP */
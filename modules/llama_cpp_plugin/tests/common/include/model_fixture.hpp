@@ -6,6 +6,8 @@
 
 #include <gtest/gtest.h>
 
+#include <numeric>
+
 #include "common_test_utils/file_utils.hpp"
 #include "openvino/openvino.hpp"
 #include "openvino/runtime/infer_request.hpp"
@@ -16,10 +18,14 @@ const auto SEP = ov::util::FileTraits<char>::file_separator;
 class CompiledModelTest : public ::testing::Test {
 public:
     static void fill_unused_inputs(ov::InferRequest& infer_request, const ov::Shape& input_ids_reference_shape) {
-        infer_request.set_tensor("attention_mask", ov::Tensor(ov::element::Type_t::i64, input_ids_reference_shape));
+        auto attention_mask = ov::Tensor(ov::element::Type_t::i64, input_ids_reference_shape);
+        std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 1);
+        infer_request.set_tensor("attention_mask", attention_mask);
 
         size_t batch_size = input_ids_reference_shape[0];
-        infer_request.set_tensor("beam_idx", ov::Tensor(ov::element::Type_t::i32, ov::Shape{batch_size}));
+        auto beam_idx = ov::Tensor(ov::element::Type_t::i32, ov::Shape{batch_size});
+        std::iota(beam_idx.data<int32_t>(), beam_idx.data<int32_t>() + batch_size, 0);
+        infer_request.set_tensor("beam_idx", beam_idx);
     }
 
 protected:
@@ -0,0 +1,95 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "llama_like_model.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "openvino/op/util/variable.hpp"
+#include "openvino/opsets/opset13.hpp"
+
+namespace {
+// the weights are generated in the logical PyTorch layout, i.e. [out, in] for the matrices, and stored transposed if
+// requested
+std::shared_ptr<ov::Node> make_weight(const std::string& name,
+                                      const ov::Shape& shape,
+                                      bool store_transposed,
+                                      std::mt19937& rng) {
+    std::uniform_real_distribution<float> distribution(-0.1f, 0.1f);
+    std::vector<float> values(ov::shape_size(shape));
+    for (auto& value : values) {
+        value = distribution(rng);
+    }
+    ov::Shape stored_shape = shape;
+    if (store_transposed) {
+        stored_shape = {shape[1], shape[0]};
+        std::vector<float> transposed(values.size());
+        for (size_t row = 0; row < shape[0]; row++) {
+            for (size_t column = 0; column < shape[1]; column++) {
+                transposed[column * shape[0] + row] = values[row * shape[1] + column];
+            }
+        }
+        values = transposed;
+    }
+    // the weights are stored in f16, as in the IRs exported with the default weight compression
+    auto f16_constant = std::make_shared<ov::opset13::Constant>(ov::element::f16, stored_shape, values);
+    f16_constant->set_friendly_name(name);
+    return std::make_shared<ov::opset13::Convert>(f16_constant, ov::element::f32);
+}
+}  // namespace
+
+std::shared_ptr<ov::Model> make_llama_like_model(bool transpose_b) {
+    std::mt19937 rng(42);
+    auto input_ids = std::make_shared<ov::opset13::Parameter>(ov::element::i64, ov::PartialShape{-1, -1});
+    input_ids->output(0).set_names({"input_ids"});
+    auto hidden = std::make_shared<ov::opset13::Convert>(input_ids, ov::element::f32);
+
+    ov::ResultVector results;
+    auto add_weight = [&](const std::string& name, const ov::Shape& shape) {
+        results.push_back(std::make_shared<ov::opset13::Result>(make_weight(name, shape, false, rng)));
+    };
+    // the projection matrices are consumed by MatMuls, which tell the layout of the weights
+    auto add_projection = [&](const std::string& name, const ov::Shape& shape) {
+        auto weight = make_weight(name, shape, !transpose_b, rng);
+        auto matmul = std::make_shared<ov::opset13::MatMul>(hidden, weight, false, transpose_b);
+        results.push_back(std::make_shared<ov::opset13::Result>(matmul));
+    };
+    add_weight("self.model.embed_tokens.weight", {N_VOCAB, N_EMBD});
+    add_weight("self.model.norm.weight", {N_EMBD});
+    add_projection("self.lm_head.weight", {N_VOCAB, N_EMBD});
+
+    ov::SinkVector sinks;
+    for (size_t layer = 0; layer < N_LAYERS; layer++) {
+        std::string prefix = "self.model.layers." + std::to_string(layer) + ".";
+        add_projection(prefix + "self_attn.q_proj.weight", {N_HEAD * HEAD_SIZE, N_EMBD});
+        add_projection(prefix + "self_attn.k_proj.weight", {N_HEAD_KV * HEAD_SIZE, N_EMBD});
+        add_projection(prefix + "self_attn.v_proj.weight", {N_HEAD_KV * HEAD_SIZE, N_EMBD});
+        add_projection(prefix + "self_attn.o_proj.weight", {N_EMBD, N_HEAD * HEAD_SIZE});
+        add_projection(prefix + "mlp.gate_proj.weight", {N_FF, N_EMBD});
+        add_projection(prefix + "mlp.up_proj.weight", {N_FF, N_EMBD});
+        add_projection(prefix + "mlp.down_proj.weight", {N_EMBD, N_FF});
+        add_weight(prefix + "input_layernorm.weight", {N_EMBD});
+        add_weight(prefix + "post_attention_layernorm.weight", {N_EMBD});
+
+        for (const std::string& kind : {"key", "value"}) {
+            std::string variable_id = "past_key_values." + std::to_string(layer) + "." + kind;
+            auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{
+                ov::PartialShape{-1, N_HEAD_KV, -1, HEAD_SIZE}, ov::element::f32, variable_id});
+            auto init = std::make_shared<ov::opset13::Constant>(ov::element::f32,
+                                                                ov::Shape{1, N_HEAD_KV, 0, HEAD_SIZE},
+                                                                std::vector<float>{});
+            auto read_value = std::make_shared<ov::opset13::ReadValue>(init, variable);
+            sinks.push_back(std::make_shared<ov::opset13::Assign>(read_value, variable));
+        }
+    }
+
+    auto axis = std::make_shared<ov::opset13::Constant>(ov::element::i64, ov::Shape{1}, std::vector<int64_t>{-1});
+    auto mean = std::make_shared<ov::opset13::ReduceMean>(hidden, axis, true);
+    auto eps =
+        std::make_shared<ov::opset13::Constant>(ov::element::f32, ov::Shape{1}, std::vector<float>{RMS_NORM_EPS});
+    results.push_back(std::make_shared<ov::opset13::Result>(std::make_shared<ov::opset13::Add>(mean, eps)));
+
+    return std::make_shared<ov::Model>(results, sinks, ov::ParameterVector{input_ids}, "llama_like_model");
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+namespace {
+void set_inputs(ov::InferRequest& infer_request, const std::vector<int64_t>& tokens) {
+    auto input_ids_tensor = ov::Tensor(ov::element::Type_t::i64, {1, tokens.size()});
+    std::copy(tokens.begin(), tokens.end(), input_ids_tensor.data<int64_t>());
+    infer_request.set_tensor("input_ids", input_ids_tensor);
+
+    ov::Tensor position_ids = infer_request.get_tensor("position_ids");
+    position_ids.set_shape(input_ids_tensor.get_shape());
+    std::iota(position_ids.data<int64_t>(), position_ids.data<int64_t>() + position_ids.get_size(), 0);
+
+    CompiledModelTest::fill_unused_inputs(infer_request, input_ids_tensor.get_shape());
+}
+}  // namespace
+
+TEST(LlamaCppAsyncInferenceTest, OptimalNumberOfInferRequestsFollowsStreams) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::num_streams(2));
+    ASSERT_EQ(model.get_property(ov::optimal_number_of_infer_requests), 2);
+    ASSERT_EQ(model.get_property(ov::num_streams), ov::streams::Num(2));
+}
+
+TEST(LlamaCppAsyncInferenceTest, PinnedAsyncRequestsMatchSyncResults) {
+    const std::vector<std::vector<int64_t>> prompts = {{5195, 318, 262, 3825, 7872}, {40, 588, 257, 3290}};
+
+    ov::Core core;
+    auto reference_model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    std::vector<std::vector<float>> reference_logits;
+    for (const auto& prompt : prompts) {
+        auto infer_request = reference_model.create_infer_request();
+        reference_logits.push_back(infer_and_get_last_logits(infer_request, prompt, 0));
+    }
+
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::num_streams(2), ov::hint::enable_cpu_pinning(true));
+    std::vector<ov::InferRequest> infer_requests;
+    std::atomic<size_t> num_callbacks{0};
+    for (const auto& prompt : prompts) {
+        infer_requests.push_back(model.create_infer_request());
+        set_inputs(infer_requests.back(), prompt);
+        infer_requests.back().set_callback([&num_callbacks](std::exception_ptr exception) {
+            if (!exception) {
+                num_callbacks++;
+            }
+        });
+    }
+    for (auto& infer_request : infer_requests) {
+        infer_request.start_async();
+    }
+    for (auto& infer_request : infer_requests) {
+        infer_request.wait();
+    }
+    ASSERT_EQ(num_callbacks, prompts.size());
+
+    for (size_t i = 0; i < prompts.size(); i++) {
+        ov::Tensor logits = infer_requests[i].get_tensor("logits");
+        size_t vocab_size = logits.get_shape().back();
+        const float* last_logits = logits.data<float>() + (prompts[i].size() - 1) * vocab_size;
+        for (size_t j = 0; j < vocab_size; j++) {
+            ASSERT_NEAR(last_logits[j], reference_logits[i][j], 1e-4);
+        }
+    }
+}
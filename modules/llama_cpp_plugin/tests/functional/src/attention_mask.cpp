@@ -0,0 +1,100 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "llama_cpp/properties.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+TEST(LlamaCppAttentionMaskTest, LeftPaddedBatchGivesSameLogitsAsUnpaddedSequences) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+
+    std::vector<int64_t> short_input{4, 8, 15};
+    std::vector<int64_t> long_input{1, 1, 2, 3, 5, 8};
+    const size_t n_padding = long_input.size() - short_input.size();
+
+    auto ref_infer_request = model.create_infer_request();
+    std::vector<float> ref_short_logits = infer_and_get_last_logits(ref_infer_request, short_input, 0);
+    ref_infer_request.reset_state();
+    std::vector<float> ref_long_logits = infer_and_get_last_logits(ref_infer_request, long_input, 0);
+
+    ov::Shape shape{2, long_input.size()};
+    ov::Tensor input_ids(ov::element::Type_t::i64, shape);
+    ov::Tensor position_ids(ov::element::Type_t::i64, shape);
+    ov::Tensor attention_mask(ov::element::Type_t::i64, shape);
+    int64_t* input_ids_data = input_ids.data<int64_t>();
+    int64_t* position_ids_data = position_ids.data<int64_t>();
+    int64_t* attention_mask_data = attention_mask.data<int64_t>();
+    for (size_t i = 0; i < long_input.size(); i++) {
+        bool is_padding = i < n_padding;
+        input_ids_data[i] = is_padding ? 0 : short_input[i - n_padding];
+        position_ids_data[i] = is_padding ? 0 : i - n_padding;
+        attention_mask_data[i] = is_padding ? 0 : 1;
+
+        input_ids_data[long_input.size() + i] = long_input[i];
+        position_ids_data[long_input.size() + i] = i;
+        attention_mask_data[long_input.size() + i] = 1;
+    }
+
+    auto infer_request = model.create_infer_request();
+    infer_request.set_tensor("input_ids", input_ids);
+    infer_request.set_tensor("position_ids", position_ids);
+    infer_request.set_tensor("attention_mask", attention_mask);
+    infer_request.infer();
+
+    auto logits = infer_request.get_tensor("logits");
+    size_t vocab_size = logits.get_shape().back();
+    const float* short_logits = logits.data<float>() + (long_input.size() - 1) * vocab_size;
+    const float* long_logits = logits.data<float>() + (2 * long_input.size() - 1) * vocab_size;
+    const float* padding_logits = logits.data<float>();
+    for (size_t i = 0; i < vocab_size; i++) {
+        ASSERT_NEAR(short_logits[i], ref_short_logits[i], 1e-3);
+        ASSERT_NEAR(long_logits[i], ref_long_logits[i], 1e-3);
+        ASSERT_EQ(padding_logits[i], 0.0f);
+    }
+}
+
+std::vector<int64_t> infer_speculative_step(ov::InferRequest& infer_request,
+                                            const std::vector<int64_t>& prompt,
+                                            bool pad_history) {
+    infer_logits_for_tokens_with_positions(infer_request, prompt, 0);
+    auto prompt_tokens = infer_request.get_tensor("speculative_token_ids");
+    const size_t n_prompt_tokens = prompt_tokens.get_size();
+
+    // the next input is the last token of the previous step, positioned after the accepted draft tokens
+    ov::Tensor input_ids(ov::element::Type_t::i64, {1, 1});
+    input_ids.data<int64_t>()[0] = prompt_tokens.data<int64_t>()[n_prompt_tokens - 1];
+    ov::Tensor position_ids(ov::element::Type_t::i64, {1, 1});
+    position_ids.data<int64_t>()[0] = prompt.size() + n_prompt_tokens - 1;
+    ov::Tensor attention_mask(ov::element::Type_t::i64, {1, prompt.size() + n_prompt_tokens});
+    std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 1);
+    if (pad_history) {
+        attention_mask.data<int64_t>()[0] = 0;
+    }
+    infer_request.set_tensor("input_ids", input_ids);
+    infer_request.set_tensor("position_ids", position_ids);
+    infer_request.set_tensor("attention_mask", attention_mask);
+    infer_request.infer();
+
+    auto step_tokens = infer_request.get_tensor("speculative_token_ids");
+    return std::vector<int64_t>(step_tokens.data<int64_t>(), step_tokens.data<int64_t>() + step_tokens.get_size());
+}
+
+TEST(LlamaCppAttentionMaskTest, PaddedHistoryDoesNotPadSubsequentTokens) {
+    // speculative decoding rejects padded inputs, so it only accepts a mask with a zero in the history columns if
+    // just the columns of the current tokens are taken into account
+    ov::Core core;
+    std::vector<int64_t> prompt{5195, 318, 262, 3825, 7872, 30};
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::draft_model(MODEL_FILE));
+
+    auto ref_infer_request = model.create_infer_request();
+    std::vector<int64_t> ref_tokens = infer_speculative_step(ref_infer_request, prompt, false);
+
+    auto infer_request = model.create_infer_request();
+    std::vector<int64_t> tokens;
+    ASSERT_NO_THROW(tokens = infer_speculative_step(infer_request, prompt, true));
+    ASSERT_EQ(tokens, ref_tokens);
+}
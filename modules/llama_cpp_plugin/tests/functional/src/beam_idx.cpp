@@ -0,0 +1,93 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+const std::vector<int64_t> GPT2_SUN_PROMPT_TOKEN_IDS = {5195, 318, 262, 3825, 7872, 30};
+const std::vector<int64_t> GPT2_LENNON_PROMPT_TOKEN_IDS = {8241, 318, 1757, 37470, 30};
+
+std::vector<int64_t> get_tokens_from_batched_logits(const ov::Tensor& logits) {
+    size_t batch_size = logits.get_shape()[0];
+    size_t vocab_size = logits.get_shape().back();
+    std::vector<int64_t> tokens;
+    for (size_t batch_idx = 0; batch_idx < batch_size; batch_idx++) {
+        const float* row = logits.data<float>() + (batch_idx + 1) * logits.get_size() / batch_size - vocab_size;
+        tokens.push_back(std::max_element(row, row + vocab_size) - row);
+    }
+    return tokens;
+}
+
+void infer_batched_step(ov::InferRequest& infer_request,
+                        const std::vector<int64_t>& tokens,
+                        int64_t position,
+                        const std::vector<int32_t>& beam_idx) {
+    size_t batch_size = tokens.size();
+    auto input_ids = ov::Tensor(ov::element::Type_t::i64, {batch_size, 1});
+    std::copy(tokens.begin(), tokens.end(), input_ids.data<int64_t>());
+    infer_request.set_tensor("input_ids", input_ids);
+
+    auto position_ids = ov::Tensor(ov::element::Type_t::i64, {batch_size, 1});
+    std::fill_n(position_ids.data<int64_t>(), batch_size, position);
+    infer_request.set_tensor("position_ids", position_ids);
+
+    auto beam_idx_tensor = ov::Tensor(ov::element::Type_t::i32, {batch_size});
+    std::copy(beam_idx.begin(), beam_idx.end(), beam_idx_tensor.data<int32_t>());
+    infer_request.set_tensor("beam_idx", beam_idx_tensor);
+
+    infer_request.infer();
+}
+
+TEST(LlamaCppBeamIdxTest, BeamsForkedFromSingleSequenceShareItsHistory) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+
+    auto ref_infer_request = model.create_infer_request();
+    auto ref_logits = infer_and_get_last_logits(ref_infer_request, GPT2_SUN_PROMPT_TOKEN_IDS, 0);
+    int64_t next_token = get_token_from_logits(ref_logits);
+    auto ref_next_logits =
+        infer_and_get_last_logits(ref_infer_request, {next_token}, GPT2_SUN_PROMPT_TOKEN_IDS.size());
+
+    auto beam_infer_request = model.create_infer_request();
+    infer_and_get_last_logits(beam_infer_request, GPT2_SUN_PROMPT_TOKEN_IDS, 0);
+    infer_batched_step(beam_infer_request, {next_token, next_token}, GPT2_SUN_PROMPT_TOKEN_IDS.size(), {0, 0});
+
+    auto beam_tokens = get_tokens_from_batched_logits(beam_infer_request.get_tensor("logits"));
+    int64_t ref_token = get_token_from_logits(ref_next_logits);
+    EXPECT_EQ(beam_tokens, (std::vector<int64_t>{ref_token, ref_token}));
+}
+
+TEST(LlamaCppBeamIdxTest, BeamReorderingSwapsSequenceHistories) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    auto infer_request = model.create_infer_request();
+
+    // the longer prompt is truncated so that both prompts form a rectangular batch
+    size_t prompt_length = GPT2_LENNON_PROMPT_TOKEN_IDS.size();
+    auto input_ids = ov::Tensor(ov::element::Type_t::i64, {2, prompt_length});
+    std::copy_n(GPT2_SUN_PROMPT_TOKEN_IDS.begin(), prompt_length, input_ids.data<int64_t>());
+    std::copy_n(GPT2_LENNON_PROMPT_TOKEN_IDS.begin(), prompt_length, input_ids.data<int64_t>() + prompt_length);
+    infer_request.set_tensor("input_ids", input_ids);
+    auto position_ids = ov::Tensor(ov::element::Type_t::i64, {2, prompt_length});
+    std::iota(position_ids.data<int64_t>(), position_ids.data<int64_t>() + prompt_length, 0);
+    std::iota(position_ids.data<int64_t>() + prompt_length, position_ids.data<int64_t>() + 2 * prompt_length, 0);
+    infer_request.set_tensor("position_ids", position_ids);
+    infer_request.infer();
+
+    auto prompt_tokens = get_tokens_from_batched_logits(infer_request.get_tensor("logits"));
+
+    infer_batched_step(infer_request, {prompt_tokens[0], prompt_tokens[1]}, prompt_length, {0, 1});
+    auto ref_tokens = get_tokens_from_batched_logits(infer_request.get_tensor("logits"));
+
+    auto swapped_infer_request = model.create_infer_request();
+    swapped_infer_request.set_tensor("input_ids", input_ids);
+    swapped_infer_request.set_tensor("position_ids", position_ids);
+    swapped_infer_request.infer();
+    infer_batched_step(swapped_infer_request, {prompt_tokens[1], prompt_tokens[0]}, prompt_length, {1, 0});
+    auto swapped_tokens = get_tokens_from_batched_logits(swapped_infer_request.get_tensor("logits"));
+
+    EXPECT_EQ(swapped_tokens, (std::vector<int64_t>{ref_tokens[1], ref_tokens[0]}));
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "common_test_utils/file_utils.hpp"
+#include "llama_cpp/properties.hpp"
+#include "llama_like_model.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+TEST(LlamaCppCachingTest, ExportedBlobIsSmallAndImportsIntoIdenticalModel) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+
+    std::stringstream blob;
+    model.export_model(blob);
+    EXPECT_LT(blob.str().size(), 4096);  // only a manifest, not the GGUF contents
+
+    auto imported_model = core.import_model(blob, "LLAMA_CPP");
+
+    std::vector<int64_t> mock_input{4, 8, 15, 16, 23, 42};
+    auto ref_infer_request = model.create_infer_request();
+    auto imported_infer_request = imported_model.create_infer_request();
+    EXPECT_EQ(infer_and_get_last_logits(ref_infer_request, mock_input, 0),
+              infer_and_get_last_logits(imported_infer_request, mock_input, 0));
+}
+
+TEST(LlamaCppCachingTest, ImportOfMalformedBlobThrows) {
+    ov::Core core;
+    std::stringstream blob("definitely not a manifest");
+    EXPECT_THROW(core.import_model(blob, "LLAMA_CPP"), ov::Exception);
+}
+
+TEST(LlamaCppCachingTest, ConversionPropertiesAreTakenIntoAccountByModelCache) {
+    const std::string cache_dir = ov::test::utils::generateTestFilePrefix() + "_llama_cpp_cache";
+    ov::test::utils::createDirectory(cache_dir);
+    const std::vector<int64_t> tokens = {1, 306, 263, 1243};
+
+    std::vector<float> q8_0_logits, f32_logits, uncached_f32_logits;
+    {
+        ov::Core core;
+        core.set_property(ov::cache_dir(cache_dir));
+        auto q8_0_model = core.compile_model(make_llama_like_model(),
+                                             "LLAMA_CPP",
+                                             ov::llama_cpp::conversion_weights_type("q8_0"));
+        auto q8_0_infer_request = q8_0_model.create_infer_request();
+        q8_0_logits = infer_and_get_last_logits(q8_0_infer_request, tokens, 0);
+
+        // the same IR with different weights type must not be imported from the entry of the q8_0 one
+        auto f32_model = core.compile_model(make_llama_like_model(),
+                                            "LLAMA_CPP",
+                                            ov::llama_cpp::conversion_weights_type("f32"));
+        auto f32_infer_request = f32_model.create_infer_request();
+        f32_logits = infer_and_get_last_logits(f32_infer_request, tokens, 0);
+    }
+    {
+        ov::Core core;
+        auto model = core.compile_model(make_llama_like_model(),
+                                        "LLAMA_CPP",
+                                        ov::llama_cpp::conversion_weights_type("f32"));
+        auto infer_request = model.create_infer_request();
+        uncached_f32_logits = infer_and_get_last_logits(infer_request, tokens, 0);
+    }
+    ov::test::utils::removeFilesWithExt(cache_dir, "blob");
+    ov::test::utils::removeDir(cache_dir);
+
+    EXPECT_NE(q8_0_logits, f32_logits);
+    EXPECT_EQ(f32_logits, uncached_f32_logits);
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "llama_cpp/properties.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+class LlamaCppChunkedPrefillTest : public testing::TestWithParam<uint32_t> {};
+
+TEST_P(LlamaCppChunkedPrefillTest, ChunkedPrefillGivesSameLogitsAsSingleBatch) {
+    ov::Core core;
+    std::vector<int64_t> mock_input{5195, 318, 262, 3825, 7872, 30, 4, 8, 15, 16, 23, 42};
+
+    auto ref_model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    auto ref_infer_request = ref_model.create_infer_request();
+    infer_logits_for_tokens_with_positions(ref_infer_request, mock_input, 0);
+    auto ref_logits_tensor = ref_infer_request.get_tensor("logits");
+
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::prefill_chunk_size(GetParam()));
+    auto infer_request = model.create_infer_request();
+    infer_logits_for_tokens_with_positions(infer_request, mock_input, 0);
+    auto logits_tensor = infer_request.get_tensor("logits");
+
+    ASSERT_EQ(logits_tensor.get_shape(), ref_logits_tensor.get_shape());
+    for (size_t i = 0; i < logits_tensor.get_size(); i++) {
+        ASSERT_NEAR(logits_tensor.data<float>()[i], ref_logits_tensor.data<float>()[i], 1e-3);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(VariousChunkSizes, LlamaCppChunkedPrefillTest, ::testing::Values(1, 5, 12, 64));
+
+TEST(LlamaCppChunkedPrefillTest, ChunkSizeIsLimitedByBatchSize) {
+    ov::Core core;
+    std::vector<int64_t> mock_input{5195, 318, 262, 3825, 7872, 30, 4, 8, 15, 16, 23, 42};
+
+    auto ref_model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    auto ref_infer_request = ref_model.create_infer_request();
+    std::vector<float> ref_logits = infer_and_get_last_logits(ref_infer_request, mock_input, 0);
+
+    // a chunk larger than n_batch would abort llama_decode instead of being split
+    auto model = core.compile_model(MODEL_FILE,
+                                    "LLAMA_CPP",
+                                    ov::llama_cpp::batch_size(4),
+                                    ov::llama_cpp::prefill_chunk_size(64));
+    auto infer_request = model.create_infer_request();
+    std::vector<float> logits = infer_and_get_last_logits(infer_request, mock_input, 0);
+
+    ASSERT_EQ(logits.size(), ref_logits.size());
+    for (size_t i = 0; i < logits.size(); i++) {
+        ASSERT_NEAR(logits[i], ref_logits[i], 1e-3);
+    }
+}
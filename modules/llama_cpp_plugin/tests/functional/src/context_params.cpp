@@ -0,0 +1,43 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "llama_cpp/properties.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+const std::vector<int64_t> GPT2_SUN_PROMPT_TOKEN_IDS = {5195, 318, 262, 3825, 7872, 30};
+
+TEST(LlamaCppContextParamsTest, ContextParamsAreReportedByCompiledModel) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE,
+                                    "LLAMA_CPP",
+                                    ov::llama_cpp::context_size(256),
+                                    ov::llama_cpp::batch_size(128),
+                                    ov::llama_cpp::micro_batch_size(64),
+                                    ov::llama_cpp::kv_cache_type("f32"));
+    EXPECT_EQ(model.get_property(ov::llama_cpp::context_size), 256);
+    EXPECT_EQ(model.get_property(ov::llama_cpp::batch_size), 128);
+    EXPECT_EQ(model.get_property(ov::llama_cpp::micro_batch_size), 64);
+    EXPECT_EQ(model.get_property(ov::llama_cpp::kv_cache_type), "f32");
+}
+
+TEST(LlamaCppContextParamsTest, SmallContextGeneratesSameTokens) {
+    ov::Core core;
+    auto ref_model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    auto ref_infer_request = ref_model.create_infer_request();
+    auto ref_logits = infer_and_get_last_logits(ref_infer_request, GPT2_SUN_PROMPT_TOKEN_IDS, 0);
+
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::context_size(64));
+    auto infer_request = model.create_infer_request();
+    auto logits = infer_and_get_last_logits(infer_request, GPT2_SUN_PROMPT_TOKEN_IDS, 0);
+
+    EXPECT_EQ(get_token_from_logits(logits), get_token_from_logits(ref_logits));
+}
+
+TEST(LlamaCppContextParamsTest, UnsupportedKVCacheTypeThrows) {
+    ov::Core core;
+    EXPECT_THROW(core.set_property("LLAMA_CPP", ov::llama_cpp::kv_cache_type("q3_k")), ov::Exception);
+}
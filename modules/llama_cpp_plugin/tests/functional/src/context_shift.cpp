@@ -0,0 +1,108 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "llama_cpp/properties.hpp"
+#include "llama_like_model.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+const std::vector<int64_t> GPT2_SUN_PROMPT_TOKEN_IDS = {5195, 318, 262, 3825, 7872, 30};
+
+constexpr uint32_t CONTEXT_SIZE = 256;
+
+TEST(LlamaCppContextShiftTest, GenerationContinuesPastContextSize) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE,
+                                    "LLAMA_CPP",
+                                    ov::llama_cpp::context_size(CONTEXT_SIZE),
+                                    ov::llama_cpp::context_shift(true),
+                                    ov::llama_cpp::context_shift_sink_tokens(GPT2_SUN_PROMPT_TOKEN_IDS.size()));
+    auto infer_request = model.create_infer_request();
+    std::vector<float> logits = infer_and_get_last_logits(infer_request, GPT2_SUN_PROMPT_TOKEN_IDS, 0);
+    std::vector<int64_t> tokens;
+    ASSERT_NO_THROW(tokens = generate_n_tokens_with_positions(infer_request,
+                                                              get_token_from_logits(logits),
+                                                              2 * CONTEXT_SIZE,
+                                                              GPT2_SUN_PROMPT_TOKEN_IDS.size()));
+    ASSERT_EQ(tokens.size(), 2 * CONTEXT_SIZE + 1);
+}
+
+TEST(LlamaCppContextShiftTest, GenerationFailsPastContextSizeWithoutShift) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::context_size(CONTEXT_SIZE));
+    auto infer_request = model.create_infer_request();
+    std::vector<float> logits = infer_and_get_last_logits(infer_request, GPT2_SUN_PROMPT_TOKEN_IDS, 0);
+    ASSERT_THROW(generate_n_tokens_with_positions(infer_request,
+                                                  get_token_from_logits(logits),
+                                                  2 * CONTEXT_SIZE,
+                                                  GPT2_SUN_PROMPT_TOKEN_IDS.size()),
+                 ov::Exception);
+}
+
+TEST(LlamaCppContextShiftTest, ShiftedContextMatchesRetainedWindow) {
+    // unlike GPT-2, the LLaMA architecture uses RoPE, so the retained keys have to be rotated to their new positions
+    constexpr uint32_t SMALL_CONTEXT_SIZE = 32;
+    constexpr size_t N_KEEP = 4;
+    ov::Core core;
+    auto model = core.compile_model(make_llama_like_model(),
+                                    "LLAMA_CPP",
+                                    ov::llama_cpp::context_size(SMALL_CONTEXT_SIZE),
+                                    ov::llama_cpp::kv_cache_type("f32"),
+                                    ov::llama_cpp::context_shift(true),
+                                    ov::llama_cpp::context_shift_sink_tokens(N_KEEP));
+    std::vector<int64_t> tokens(SMALL_CONTEXT_SIZE + 1);
+    for (size_t i = 0; i < tokens.size(); i++) {
+        tokens[i] = static_cast<int64_t>((i * 37 + 11) % N_VOCAB);
+    }
+
+    // the context is full after the first SMALL_CONTEXT_SIZE tokens, so the last one is preceded by a shift
+    auto infer_request = model.create_infer_request();
+    infer_logits_for_tokens_with_positions(infer_request,
+                                           std::vector<int64_t>(tokens.begin(), tokens.end() - 1),
+                                           0);
+    std::vector<float> shifted_logits = infer_and_get_last_logits(infer_request, {tokens.back()}, tokens.size() - 1);
+
+    // the shift discards half of the tokens after the sink ones, and the rest are moved to the positions following
+    // the sink tokens, as if they had been processed right after them
+    const size_t n_discard = (SMALL_CONTEXT_SIZE - N_KEEP) / 2;
+    std::vector<int64_t> retained_tokens(tokens.begin(), tokens.begin() + N_KEEP);
+    retained_tokens.insert(retained_tokens.end(), tokens.begin() + N_KEEP + n_discard, tokens.end());
+    auto ref_infer_request = model.create_infer_request();
+    std::vector<float> ref_logits = infer_and_get_last_logits(ref_infer_request, retained_tokens, 0);
+
+    ASSERT_EQ(shifted_logits.size(), ref_logits.size());
+    for (size_t i = 0; i < ref_logits.size(); i++) {
+        ASSERT_NEAR(shifted_logits[i], ref_logits[i], 1e-3);
+    }
+
+    // without the shift the keys of the retained tokens would keep their original rotation, so the same window fed at
+    // the original positions must produce different logits for the comparison above to be meaningful
+    std::vector<int64_t> unshifted_positions(N_KEEP);
+    std::iota(unshifted_positions.begin(), unshifted_positions.end(), 0);
+    for (size_t i = N_KEEP + n_discard; i < tokens.size(); i++) {
+        unshifted_positions.push_back(static_cast<int64_t>(i));
+    }
+    auto unshifted_infer_request = model.create_infer_request();
+    auto input_ids = ov::Tensor(ov::element::Type_t::i64, {1, retained_tokens.size()});
+    std::copy(retained_tokens.begin(), retained_tokens.end(), input_ids.data<int64_t>());
+    unshifted_infer_request.set_tensor("input_ids", input_ids);
+    auto position_ids = ov::Tensor(ov::element::Type_t::i64, {1, unshifted_positions.size()});
+    std::copy(unshifted_positions.begin(), unshifted_positions.end(), position_ids.data<int64_t>());
+    unshifted_infer_request.set_tensor("position_ids", position_ids);
+    CompiledModelTest::fill_unused_inputs(unshifted_infer_request, input_ids.get_shape());
+    unshifted_infer_request.infer();
+    ov::Tensor unshifted_logits = unshifted_infer_request.get_tensor("logits");
+    const float* last_unshifted_logits = unshifted_logits.data<float>() + unshifted_logits.get_size() - N_VOCAB;
+    float max_difference = 0.0f;
+    for (size_t i = 0; i < ref_logits.size(); i++) {
+        max_difference = std::max(max_difference, std::abs(last_unshifted_logits[i] - ref_logits[i]));
+    }
+    ASSERT_GT(max_difference, 1e-2f);
+}
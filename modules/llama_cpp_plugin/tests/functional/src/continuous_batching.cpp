@@ -0,0 +1,75 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "llama_cpp/properties.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+const std::vector<std::vector<int64_t>> GPT2_PROMPTS_TOKEN_IDS = {{5195, 318, 262, 3825, 7872, 30},
+                                                                  {8241, 318, 1757, 37470, 30},
+                                                                  {4, 8, 15, 16, 23, 42},
+                                                                  {1, 1, 2, 3, 5, 8}};
+constexpr size_t NUM_TOKENS_TO_GENERATE = 16;
+
+std::vector<int64_t> generate_for_prompt(ov::InferRequest& infer_request, const std::vector<int64_t>& prompt) {
+    auto logits = infer_and_get_last_logits(infer_request, prompt, 0);
+    return generate_n_tokens_with_positions(infer_request,
+                                            get_token_from_logits(logits),
+                                            NUM_TOKENS_TO_GENERATE,
+                                            prompt.size());
+}
+
+TEST(LlamaCppContinuousBatchingTest, ConcurrentRequestsOnSharedContextGenerateSameTokens) {
+    ov::Core core;
+    auto ref_model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    std::vector<std::vector<int64_t>> ref_outputs;
+    for (const auto& prompt : GPT2_PROMPTS_TOKEN_IDS) {
+        auto infer_request = ref_model.create_infer_request();
+        ref_outputs.push_back(generate_for_prompt(infer_request, prompt));
+    }
+
+    auto shared_model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::continuous_batching(true));
+    std::vector<ov::InferRequest> infer_requests;
+    for (size_t i = 0; i < GPT2_PROMPTS_TOKEN_IDS.size(); i++) {
+        infer_requests.push_back(shared_model.create_infer_request());
+    }
+
+    std::vector<std::vector<int64_t>> outputs(GPT2_PROMPTS_TOKEN_IDS.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < GPT2_PROMPTS_TOKEN_IDS.size(); i++) {
+        threads.emplace_back([&, i] {
+            outputs[i] = generate_for_prompt(infer_requests[i], GPT2_PROMPTS_TOKEN_IDS[i]);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(outputs, ref_outputs);
+}
+
+TEST(LlamaCppContinuousBatchingTest, ResetStateOnlyAffectsOwnSequences) {
+    ov::Core core;
+    auto ref_model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    auto ref_infer_request = ref_model.create_infer_request();
+    auto ref_output = generate_for_prompt(ref_infer_request, GPT2_PROMPTS_TOKEN_IDS[0]);
+
+    auto shared_model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::continuous_batching(true));
+    auto infer_request = shared_model.create_infer_request();
+    auto other_infer_request = shared_model.create_infer_request();
+
+    // the other request's state is reset in the middle of the generation, which must not affect the first request
+    auto logits = infer_and_get_last_logits(infer_request, GPT2_PROMPTS_TOKEN_IDS[0], 0);
+    infer_and_get_last_logits(other_infer_request, GPT2_PROMPTS_TOKEN_IDS[1], 0);
+    other_infer_request.reset_state();
+    auto output = generate_n_tokens_with_positions(infer_request,
+                                                   get_token_from_logits(logits),
+                                                   NUM_TOKENS_TO_GENERATE,
+                                                   GPT2_PROMPTS_TOKEN_IDS[0].size());
+    EXPECT_EQ(output, ref_output);
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "llama_cpp/properties.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+const std::vector<int64_t> GPT2_SUN_PROMPT_TOKEN_IDS = {5195, 318, 262, 3825, 7872, 30};
+
+ov::Tensor infer_embeddings(ov::CompiledModel& model, const std::string& output_name) {
+    auto infer_request = model.create_infer_request();
+    infer_logits_for_tokens_with_positions(infer_request, GPT2_SUN_PROMPT_TOKEN_IDS, 0);
+    return infer_request.get_tensor(output_name);
+}
+
+TEST(LlamaCppEmbeddingsTest, LastHiddenStateHasOneRowPerToken) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::embeddings(true));
+    ASSERT_EQ(model.outputs().size(), 1);
+    ASSERT_EQ(model.output().get_any_name(), "last_hidden_state");
+
+    ov::Tensor hidden_states = infer_embeddings(model, "last_hidden_state");
+    ASSERT_EQ(hidden_states.get_shape().size(), 3);
+    ASSERT_EQ(hidden_states.get_shape()[0], 1);
+    ASSERT_EQ(hidden_states.get_shape()[1], GPT2_SUN_PROMPT_TOKEN_IDS.size());
+}
+
+TEST(LlamaCppEmbeddingsTest, PooledEmbeddingsMatchHiddenStates) {
+    ov::Core core;
+    auto hidden_states_model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::embeddings(true));
+    ov::Tensor hidden_states = infer_embeddings(hidden_states_model, "last_hidden_state");
+    size_t n_tokens = hidden_states.get_shape()[1];
+    size_t n_embd = hidden_states.get_shape()[2];
+    const float* hidden_states_data = hidden_states.data<float>();
+
+    for (const std::string& pooling_type : {"mean", "cls", "last"}) {
+        auto model = core.compile_model(MODEL_FILE,
+                                        "LLAMA_CPP",
+                                        ov::llama_cpp::embeddings(true),
+                                        ov::llama_cpp::pooling_type(pooling_type));
+        ov::Tensor embeddings = infer_embeddings(model, "embeddings");
+        ASSERT_EQ(embeddings.get_shape(), (ov::Shape{1, n_embd}));
+        for (size_t i = 0; i < n_embd; i++) {
+            float expected = 0.0f;
+            if (pooling_type == "mean") {
+                for (size_t token_idx = 0; token_idx < n_tokens; token_idx++) {
+                    expected += hidden_states_data[token_idx * n_embd + i] / n_tokens;
+                }
+            } else if (pooling_type == "cls") {
+                expected = hidden_states_data[i];
+            } else {
+                expected = hidden_states_data[(n_tokens - 1) * n_embd + i];
+            }
+            ASSERT_NEAR(embeddings.data<float>()[i], expected, 1e-3) << "pooling type " << pooling_type;
+        }
+    }
+}
+
+TEST(LlamaCppEmbeddingsTest, ThrowsWithGenerationOutputs) {
+    ov::Core core;
+    ASSERT_THROW(core.compile_model(MODEL_FILE,
+                                    "LLAMA_CPP",
+                                    ov::llama_cpp::embeddings(true),
+                                    ov::llama_cpp::greedy_output(true)),
+                 ov::Exception);
+}
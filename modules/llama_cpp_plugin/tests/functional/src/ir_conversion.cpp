@@ -0,0 +1,221 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <sstream>
+
+#include "llama_cpp/properties.hpp"
+#include "llama_like_model.hpp"
+#include "llm_inference.hpp"
+#include "openvino/opsets/opset13.hpp"
+
+namespace {
+// HF rotary embedding base, which the conversion assumes for the IRs without the inverse frequencies
+constexpr float ROPE_FREQ_BASE = 10000.0f;
+
+using Weights = std::map<std::string, std::vector<float>>;
+
+Weights get_weights(const std::shared_ptr<ov::Model>& model) {
+    Weights weights;
+    for (const auto& node : model->get_ordered_ops()) {
+        auto constant = ov::as_type_ptr<ov::opset13::Constant>(node);
+        if (constant && constant->get_friendly_name().find(".weight") != std::string::npos) {
+            weights[constant->get_friendly_name()] = constant->cast_vector<float>();
+        }
+    }
+    return weights;
+}
+
+// y = W x for W of the [out, in] layout
+std::vector<float> project(const std::vector<float>& weight, const std::vector<float>& x) {
+    std::vector<float> y(weight.size() / x.size(), 0.0f);
+    for (size_t row = 0; row < y.size(); row++) {
+        for (size_t column = 0; column < x.size(); column++) {
+            y[row] += weight[row * x.size() + column] * x[column];
+        }
+    }
+    return y;
+}
+
+std::vector<float> rms_norm(const std::vector<float>& x, const std::vector<float>& weight) {
+    float sum_of_squares = 0.0f;
+    for (float value : x) {
+        sum_of_squares += value * value;
+    }
+    const float scale = 1.0f / std::sqrt(sum_of_squares / x.size() + RMS_NORM_EPS);
+    std::vector<float> y(x.size());
+    for (size_t i = 0; i < x.size(); i++) {
+        y[i] = x[i] * scale * weight[i];
+    }
+    return y;
+}
+
+// the HF rotary embedding, which rotates the dimension pairs (i, i + head_size / 2) of each head
+void apply_rotary_embedding(std::vector<float>& x, size_t position) {
+    for (size_t head = 0; head < x.size() / HEAD_SIZE; head++) {
+        float* head_values = x.data() + head * HEAD_SIZE;
+        for (size_t i = 0; i < HEAD_SIZE / 2; i++) {
+            const float theta = position * std::pow(ROPE_FREQ_BASE, -2.0f * i / HEAD_SIZE);
+            const float first = head_values[i];
+            const float second = head_values[i + HEAD_SIZE / 2];
+            head_values[i] = first * std::cos(theta) - second * std::sin(theta);
+            head_values[i + HEAD_SIZE / 2] = second * std::cos(theta) + first * std::sin(theta);
+        }
+    }
+}
+
+// A straightforward implementation of the HF LLaMA forward pass, which returns the logits of the last token
+std::vector<float> infer_reference_logits(const Weights& weights, const std::vector<int64_t>& tokens) {
+    const std::vector<float>& embeddings = weights.at("self.model.embed_tokens.weight");
+    std::vector<std::vector<float>> hidden;
+    for (int64_t token : tokens) {
+        hidden.emplace_back(embeddings.begin() + token * N_EMBD, embeddings.begin() + (token + 1) * N_EMBD);
+    }
+
+    for (size_t layer = 0; layer < N_LAYERS; layer++) {
+        const std::string prefix = "self.model.layers." + std::to_string(layer) + ".";
+        std::vector<std::vector<float>> keys, values;
+        for (size_t position = 0; position < tokens.size(); position++) {
+            std::vector<float> x = rms_norm(hidden[position], weights.at(prefix + "input_layernorm.weight"));
+            std::vector<float> query = project(weights.at(prefix + "self_attn.q_proj.weight"), x);
+            keys.push_back(project(weights.at(prefix + "self_attn.k_proj.weight"), x));
+            values.push_back(project(weights.at(prefix + "self_attn.v_proj.weight"), x));
+            apply_rotary_embedding(query, position);
+            apply_rotary_embedding(keys.back(), position);
+
+            // causal grouped-query attention over the tokens up to the current one
+            std::vector<float> attention(N_HEAD * HEAD_SIZE, 0.0f);
+            for (size_t head = 0; head < N_HEAD; head++) {
+                const size_t kv_head = head / (N_HEAD / N_HEAD_KV);
+                std::vector<float> scores(position + 1);
+                for (size_t past = 0; past <= position; past++) {
+                    float score = 0.0f;
+                    for (size_t i = 0; i < HEAD_SIZE; i++) {
+                        score += query[head * HEAD_SIZE + i] * keys[past][kv_head * HEAD_SIZE + i];
+                    }
+                    scores[past] = score / std::sqrt(static_cast<float>(HEAD_SIZE));
+                }
+                const float max_score = *std::max_element(scores.begin(), scores.end());
+                float sum = 0.0f;
+                for (auto& score : scores) {
+                    score = std::exp(score - max_score);
+                    sum += score;
+                }
+                for (size_t past = 0; past <= position; past++) {
+                    for (size_t i = 0; i < HEAD_SIZE; i++) {
+                        attention[head * HEAD_SIZE + i] += scores[past] / sum * values[past][kv_head * HEAD_SIZE + i];
+                    }
+                }
+            }
+            std::vector<float> attention_output = project(weights.at(prefix + "self_attn.o_proj.weight"), attention);
+
+            std::vector<float>& residual = hidden[position];
+            for (size_t i = 0; i < N_EMBD; i++) {
+                residual[i] += attention_output[i];
+            }
+            x = rms_norm(residual, weights.at(prefix + "post_attention_layernorm.weight"));
+            std::vector<float> gate = project(weights.at(prefix + "mlp.gate_proj.weight"), x);
+            std::vector<float> up = project(weights.at(prefix + "mlp.up_proj.weight"), x);
+            for (size_t i = 0; i < N_FF; i++) {
+                gate[i] = gate[i] / (1.0f + std::exp(-gate[i])) * up[i];
+            }
+            std::vector<float> mlp_output = project(weights.at(prefix + "mlp.down_proj.weight"), gate);
+            for (size_t i = 0; i < N_EMBD; i++) {
+                residual[i] += mlp_output[i];
+            }
+        }
+    }
+    std::vector<float> x = rms_norm(hidden.back(), weights.at("self.model.norm.weight"));
+    return project(weights.at("self.lm_head.weight"), x);
+}
+
+void check_logits_are_finite(ov::InferRequest& infer_request, size_t n_tokens) {
+    ov::Tensor logits = infer_request.get_tensor("logits");
+    ASSERT_EQ(logits.get_shape(), (ov::Shape{1, n_tokens, N_VOCAB}));
+    for (size_t i = 0; i < logits.get_size(); i++) {
+        ASSERT_TRUE(std::isfinite(logits.data<float>()[i]));
+    }
+}
+}  // namespace
+
+TEST(LlamaCppIrConversionTest, ThrowsOnNonLlmModels) {
+    auto param = std::make_shared<ov::opset13::Parameter>(ov::element::f32, ov::Shape{1, 8});
+    auto relu = std::make_shared<ov::opset13::Relu>(param);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset13::Result>(relu)},
+                                             ov::ParameterVector{param});
+    ov::Core core;
+    ASSERT_THROW(core.compile_model(model, "LLAMA_CPP"), ov::Exception);
+}
+
+TEST(LlamaCppIrConversionTest, ConvertedModelKeepsKvCacheAcrossInferences) {
+    ov::Core core;
+    auto model = core.compile_model(make_llama_like_model(), "LLAMA_CPP");
+
+    auto full_request = model.create_infer_request();
+    std::vector<float> full_logits = infer_and_get_last_logits(full_request, {1, 306, 263, 1243}, 0);
+    check_logits_are_finite(full_request, 4);
+
+    auto incremental_request = model.create_infer_request();
+    infer_logits_for_tokens_with_positions(incremental_request, {1, 306, 263}, 0);
+    std::vector<float> incremental_logits = infer_and_get_last_logits(incremental_request, {1243}, 3);
+
+    ASSERT_EQ(full_logits.size(), N_VOCAB);
+    for (size_t i = 0; i < N_VOCAB; i++) {
+        ASSERT_NEAR(full_logits[i], incremental_logits[i], 1e-3);
+    }
+}
+
+TEST(LlamaCppIrConversionTest, QuantizesWeightsToQ8_0) {
+    ov::Core core;
+    auto model = core.compile_model(make_llama_like_model(),
+                                    "LLAMA_CPP",
+                                    ov::llama_cpp::conversion_weights_type("q8_0"));
+    auto infer_request = model.create_infer_request();
+    infer_logits_for_tokens_with_positions(infer_request, {1, 306, 263}, 0);
+    check_logits_are_finite(infer_request, 3);
+}
+
+TEST(LlamaCppIrConversionTest, ExportedModelEmbedsConvertedGguf) {
+    ov::Core core;
+    std::stringstream exported;
+    std::vector<float> reference_logits;
+    {
+        auto model = core.compile_model(make_llama_like_model(), "LLAMA_CPP");
+        auto infer_request = model.create_infer_request();
+        reference_logits = infer_and_get_last_logits(infer_request, {1, 306, 263}, 0);
+        model.export_model(exported);
+    }
+
+    // the temporary GGUF file of the original compiled model is gone at this point
+    auto imported_model = core.import_model(exported, "LLAMA_CPP");
+    auto infer_request = imported_model.create_infer_request();
+    std::vector<float> logits = infer_and_get_last_logits(infer_request, {1, 306, 263}, 0);
+    ASSERT_EQ(logits, reference_logits);
+}
+
+TEST(LlamaCppIrConversionTest, ConvertedModelMatchesReferenceImplementation) {
+    // the rotary embedding only affects the tokens after the first one, so this also checks the permutation of the
+    // Q and K projection rows
+    const std::vector<int64_t> tokens = {1, 306, 263, 1243};
+    auto ir_model = make_llama_like_model();
+    std::vector<float> reference_logits = infer_reference_logits(get_weights(ir_model), tokens);
+
+    // both layouts of the projection matrices describe the same weights
+    ov::Core core;
+    for (bool transpose_b : {true, false}) {
+        auto model = core.compile_model(make_llama_like_model(transpose_b),
+                                        "LLAMA_CPP",
+                                        ov::llama_cpp::conversion_weights_type("f32"),
+                                        ov::llama_cpp::kv_cache_type("f32"));
+        auto infer_request = model.create_infer_request();
+        std::vector<float> logits = infer_and_get_last_logits(infer_request, tokens, 0);
+        ASSERT_EQ(logits.size(), reference_logits.size());
+        for (size_t i = 0; i < logits.size(); i++) {
+            ASSERT_NEAR(logits[i], reference_logits[i], 1e-3) << "transpose_b = " << transpose_b;
+        }
+    }
+}
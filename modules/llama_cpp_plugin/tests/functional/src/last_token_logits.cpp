@@ -0,0 +1,46 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "llama_cpp/properties.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+TEST(LlamaCppLastTokenLogitsTest, LastTokenLogitsAreIdenticalToFullLogits) {
+    ov::Core core;
+    std::vector<int64_t> mock_input{4, 8, 15, 16, 23, 42};
+
+    auto full_model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    auto full_infer_request = full_model.create_infer_request();
+    std::vector<float> ref_last_logits = infer_and_get_last_logits(full_infer_request, mock_input, 0);
+
+    auto last_token_model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::logits_last_token_only(true));
+    auto last_token_infer_request = last_token_model.create_infer_request();
+    infer_logits_for_tokens_with_positions(last_token_infer_request, mock_input, 0);
+
+    auto logits_tensor = last_token_infer_request.get_tensor("logits");
+    ASSERT_EQ(logits_tensor.get_shape(), (ov::Shape{1, 1, ref_last_logits.size()}));
+    std::vector<float> last_logits(logits_tensor.data<float>(), logits_tensor.data<float>() + logits_tensor.get_size());
+    EXPECT_EQ(last_logits, ref_last_logits);
+}
+
+TEST(LlamaCppLastTokenLogitsTest, CompiledModelReportsPropertiesAsReadOnly) {
+    ov::Core core;
+    // the properties unknown to the plugin, e.g. the hints meant for other devices, are ignored
+    auto model = core.compile_model(MODEL_FILE,
+                                    "LLAMA_CPP",
+                                    ov::llama_cpp::logits_last_token_only(true),
+                                    ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY));
+    ASSERT_TRUE(model.get_property(ov::llama_cpp::logits_last_token_only));
+
+    auto supported_properties = model.get_property(ov::supported_properties);
+    auto it = std::find(supported_properties.begin(),
+                        supported_properties.end(),
+                        ov::llama_cpp::logits_last_token_only.name());
+    ASSERT_NE(it, supported_properties.end());
+    EXPECT_FALSE(it->is_mutable());
+}
@@ -0,0 +1,28 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "llama_cpp/properties.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+const std::vector<int64_t> GPT2_SUN_PROMPT_TOKEN_IDS = {5195, 318, 262, 3825, 7872, 30};
+
+TEST(LlamaCppModelSharingTest, ModelStaysUsableAfterAnotherModelForSameFileIsDestroyed) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    auto infer_request = model.create_infer_request();
+    auto ref_logits = infer_and_get_last_logits(infer_request, GPT2_SUN_PROMPT_TOKEN_IDS, 0);
+
+    {
+        auto other_model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::context_size(128));
+        auto other_infer_request = other_model.create_infer_request();
+        infer_and_get_last_logits(other_infer_request, GPT2_SUN_PROMPT_TOKEN_IDS, 0);
+    }
+
+    infer_request.reset_state();
+    auto logits = infer_and_get_last_logits(infer_request, GPT2_SUN_PROMPT_TOKEN_IDS, 0);
+    EXPECT_EQ(logits, ref_logits);
+}
@@ -0,0 +1,64 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "llama_cpp/properties.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+const std::vector<int64_t> COMMON_PREFIX_TOKEN_IDS = {5195, 318, 262, 3825, 7872, 30, 198};
+
+std::vector<float> infer_last_token_logits(ov::InferRequest& infer_request, const std::vector<int64_t>& suffix) {
+    std::vector<int64_t> prompt = COMMON_PREFIX_TOKEN_IDS;
+    prompt.insert(prompt.end(), suffix.begin(), suffix.end());
+
+    infer_logits_for_tokens_with_positions(infer_request, prompt, 0);
+    auto logits = infer_request.get_tensor("logits");
+    return std::vector<float>(logits.data<float>(), logits.data<float>() + logits.get_size());
+}
+
+// the number of the prompt tokens evaluated by the last inference, as reported in the profiling info
+size_t get_evaluated_prompt_tokens(ov::InferRequest& infer_request) {
+    for (const auto& info : infer_request.get_profiling_info()) {
+        if (info.node_name == "PromptEval") {
+            const std::string key = "n_tokens=";
+            size_t key_pos = info.exec_type.find(key);
+            EXPECT_NE(key_pos, std::string::npos);
+            return std::stoul(info.exec_type.substr(key_pos + key.size()));
+        }
+    }
+    ADD_FAILURE() << "no PromptEval stage in the profiling info";
+    return 0;
+}
+
+TEST(LlamaCppPrefixCacheTest, PromptsWithCachedPrefixProduceSameLogits) {
+    ov::Core core;
+    auto ref_model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::logits_last_token_only(true));
+    auto cached_model = core.compile_model(MODEL_FILE,
+                                           "LLAMA_CPP",
+                                           ov::enable_profiling(true),
+                                           ov::llama_cpp::logits_last_token_only(true),
+                                           ov::llama_cpp::prefix_cache_size(4),
+                                           ov::llama_cpp::prefix_cache_min_tokens(COMMON_PREFIX_TOKEN_IDS.size()));
+
+    // the first prompt is only recorded, the second one stores the common prefix, the third one restores it
+    std::vector<std::vector<int64_t>> suffixes = {{8241, 318}, {1757, 37470, 30}, {464, 3825}};
+    for (size_t i = 0; i < suffixes.size(); i++) {
+        auto ref_infer_request = ref_model.create_infer_request();
+        auto ref_logits = infer_last_token_logits(ref_infer_request, suffixes[i]);
+        auto cached_infer_request = cached_model.create_infer_request();
+        auto cached_logits = infer_last_token_logits(cached_infer_request, suffixes[i]);
+        ASSERT_EQ(ref_logits.size(), cached_logits.size());
+        for (size_t j = 0; j < ref_logits.size(); j++) {
+            ASSERT_NEAR(ref_logits[j], cached_logits[j], 1e-3);
+        }
+
+        // only the suffix is evaluated once the prefix is restored from the cache
+        size_t expected_tokens = suffixes[i].size() + (i == suffixes.size() - 1 ? 0 : COMMON_PREFIX_TOKEN_IDS.size());
+        ASSERT_EQ(get_evaluated_prompt_tokens(cached_infer_request), expected_tokens);
+    }
+}
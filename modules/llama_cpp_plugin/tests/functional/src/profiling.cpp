@@ -0,0 +1,45 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+TEST(LlamaCppProfilingTest, NoProfilingInfoByDefault) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    auto infer_request = model.create_infer_request();
+    infer_logits_for_tokens_with_positions(infer_request, {5195, 318, 262}, 0);
+    ASSERT_TRUE(infer_request.get_profiling_info().empty());
+}
+
+TEST(LlamaCppProfilingTest, ReportsPromptAndTokenEvalStages) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::enable_profiling(true));
+    auto infer_request = model.create_infer_request();
+
+    infer_logits_for_tokens_with_positions(infer_request, {5195, 318, 262, 3825, 7872}, 0);
+    auto prompt_profiling_info = infer_request.get_profiling_info();
+    ASSERT_EQ(prompt_profiling_info.size(), 4);
+    for (const auto& info : prompt_profiling_info) {
+        if (info.node_name == "TokenEval") {
+            ASSERT_EQ(info.status, ov::ProfilingInfo::Status::NOT_RUN);
+        } else {
+            ASSERT_EQ(info.status, ov::ProfilingInfo::Status::EXECUTED);
+        }
+    }
+
+    infer_logits_for_tokens_with_positions(infer_request, {30}, 5);
+    auto token_profiling_info = infer_request.get_profiling_info();
+    ASSERT_EQ(token_profiling_info.size(), 4);
+    for (const auto& info : token_profiling_info) {
+        if (info.node_name == "PromptEval") {
+            ASSERT_EQ(info.status, ov::ProfilingInfo::Status::NOT_RUN);
+        } else if (info.node_name == "TokenEval") {
+            ASSERT_EQ(info.status, ov::ProfilingInfo::Status::EXECUTED);
+            ASSERT_NE(info.exec_type.find("tokens_per_second="), std::string::npos);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "llama_cpp/properties.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+const std::vector<int64_t> MOCK_INPUT{5195, 318, 262, 3825, 7872, 30};
+
+TEST(LlamaCppSamplingTest, GreedyOutputMatchesLogitsArgmax) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::greedy_output(true));
+    auto infer_request = model.create_infer_request();
+    infer_logits_for_tokens_with_positions(infer_request, MOCK_INPUT, 0);
+
+    auto logits = infer_request.get_tensor("logits");
+    auto greedy_token_ids = infer_request.get_tensor("greedy_token_ids");
+    size_t n_vocab = logits.get_shape().back();
+    ASSERT_EQ(greedy_token_ids.get_shape(), (ov::Shape{1, MOCK_INPUT.size()}));
+    for (size_t i = 0; i < MOCK_INPUT.size(); i++) {
+        std::vector<float> row(logits.data<float>() + i * n_vocab, logits.data<float>() + (i + 1) * n_vocab);
+        ASSERT_EQ(greedy_token_ids.data<int64_t>()[i], get_token_from_logits(row));
+    }
+}
+
+TEST(LlamaCppSamplingTest, TopKOutputIsSortedByProbability) {
+    ov::Core core;
+    const uint32_t k = 5;
+    auto model = core.compile_model(MODEL_FILE,
+                                    "LLAMA_CPP",
+                                    ov::llama_cpp::logits_last_token_only(true),
+                                    ov::llama_cpp::greedy_output(true),
+                                    ov::llama_cpp::top_k_output(k));
+    auto infer_request = model.create_infer_request();
+    infer_logits_for_tokens_with_positions(infer_request, MOCK_INPUT, 0);
+
+    auto top_k_token_ids = infer_request.get_tensor("top_k_token_ids");
+    auto top_k_probs = infer_request.get_tensor("top_k_probs");
+    ASSERT_EQ(top_k_token_ids.get_shape(), (ov::Shape{1, 1, k}));
+    ASSERT_EQ(top_k_probs.get_shape(), (ov::Shape{1, 1, k}));
+    ASSERT_EQ(top_k_token_ids.data<int64_t>()[0], infer_request.get_tensor("greedy_token_ids").data<int64_t>()[0]);
+    for (size_t i = 1; i < k; i++) {
+        ASSERT_GE(top_k_probs.data<float>()[i - 1], top_k_probs.data<float>()[i]);
+    }
+    ASSERT_GT(top_k_probs.data<float>()[0], 0.0f);
+    ASSERT_LE(top_k_probs.data<float>()[0], 1.0f);
+}
+
+TEST(LlamaCppSamplingTest, NucleusOfOneTokenSamplesGreedily) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE,
+                                    "LLAMA_CPP",
+                                    ov::llama_cpp::logits_last_token_only(true),
+                                    ov::llama_cpp::logits_output(false),
+                                    ov::llama_cpp::greedy_output(true),
+                                    ov::llama_cpp::sampling_temperature(0.8f),
+                                    ov::llama_cpp::sampling_top_p(1e-6f));
+    ASSERT_EQ(model.outputs().size(), 2);
+
+    auto infer_request = model.create_infer_request();
+    infer_logits_for_tokens_with_positions(infer_request, MOCK_INPUT, 0);
+    ASSERT_EQ(infer_request.get_tensor("sampled_token_ids").data<int64_t>()[0],
+              infer_request.get_tensor("greedy_token_ids").data<int64_t>()[0]);
+}
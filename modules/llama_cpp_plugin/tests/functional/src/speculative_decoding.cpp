@@ -0,0 +1,53 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "llama_cpp/properties.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+
+TEST(LlamaCppSpeculativeDecodingTest, GeneratesSameTokensAsGreedyDecoding) {
+    ov::Core core;
+    std::vector<int64_t> prompt{5195, 318, 262, 3825, 7872, 30};
+    const size_t n_tokens_to_generate = 16;
+
+    auto ref_model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    auto ref_infer_request = ref_model.create_infer_request();
+    int64_t first_token = get_token_from_logits(infer_and_get_last_logits(ref_infer_request, prompt, 0));
+    std::vector<int64_t> ref_tokens =
+        generate_n_tokens_with_positions(ref_infer_request, first_token, n_tokens_to_generate, prompt.size());
+
+    // the main model itself serves as the draft, so that all of the draft tokens are accepted
+    auto model = core.compile_model(MODEL_FILE,
+                                    "LLAMA_CPP",
+                                    ov::llama_cpp::draft_model(MODEL_FILE),
+                                    ov::llama_cpp::num_draft_tokens(3));
+    auto infer_request = model.create_infer_request();
+    std::vector<int64_t> tokens;
+    std::vector<int64_t> input = prompt;
+    int64_t position = 0;
+    while (tokens.size() < ref_tokens.size()) {
+        infer_logits_for_tokens_with_positions(infer_request, input, position);
+        position += input.size();
+        auto speculative_token_ids = infer_request.get_tensor("speculative_token_ids");
+        ASSERT_EQ(speculative_token_ids.get_size(), 4);
+        tokens.insert(tokens.end(),
+                      speculative_token_ids.data<int64_t>(),
+                      speculative_token_ids.data<int64_t>() + speculative_token_ids.get_size());
+        position += speculative_token_ids.get_size() - 1;
+        input = {tokens.back()};
+    }
+    tokens.resize(ref_tokens.size());
+    ASSERT_EQ(tokens, ref_tokens);
+}
+
+TEST(LlamaCppSpeculativeDecodingTest, ThrowsWithContinuousBatching) {
+    ov::Core core;
+    ASSERT_THROW(core.compile_model(MODEL_FILE,
+                                    "LLAMA_CPP",
+                                    ov::llama_cpp::draft_model(MODEL_FILE),
+                                    ov::llama_cpp::continuous_batching(true)),
+                 ov::Exception);
+}
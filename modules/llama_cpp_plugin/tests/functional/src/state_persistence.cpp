@@ -0,0 +1,121 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include "llama_cpp/properties.hpp"
+#include "llm_inference.hpp"
+
+const std::string MODEL_FILE = ov::test::utils::getCurrentWorkingDir() + SEP + TEST_FILES_DIR + SEP + "gpt2.gguf";
+const std::vector<int64_t> GPT2_SUN_PROMPT_TOKEN_IDS = {5195, 318, 262, 3825, 7872, 30};
+const std::vector<int64_t> GPT2_LENNON_PROMPT_TOKEN_IDS = {8241, 318, 1757, 37470, 30};
+
+constexpr size_t NUM_TOKENS_TO_GENERATE = 16;
+
+TEST(LlamaCppStatePersistenceTest, RestoredStateContinuesGeneration) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+
+    auto infer_request = model.create_infer_request();
+    std::vector<float> logits = infer_and_get_last_logits(infer_request, GPT2_SUN_PROMPT_TOKEN_IDS, 0);
+    int64_t first_token = get_token_from_logits(logits);
+
+    auto states = infer_request.query_state();
+    ASSERT_EQ(states.size(), 1);
+    ov::Tensor saved_state = states[0].get_state();
+    ASSERT_EQ(saved_state.get_element_type(), ov::element::u8);
+    ASSERT_GT(saved_state.get_size(), 0);
+
+    std::vector<int64_t> ref_tokens = generate_n_tokens_with_positions(infer_request,
+                                                                       first_token,
+                                                                       NUM_TOKENS_TO_GENERATE,
+                                                                       GPT2_SUN_PROMPT_TOKEN_IDS.size());
+
+    // a fresh infer request resumes the generation from the saved state without processing the prompt again
+    auto resumed_infer_request = model.create_infer_request();
+    resumed_infer_request.query_state()[0].set_state(saved_state);
+    std::vector<int64_t> resumed_tokens = generate_n_tokens_with_positions(resumed_infer_request,
+                                                                           first_token,
+                                                                           NUM_TOKENS_TO_GENERATE,
+                                                                           GPT2_SUN_PROMPT_TOKEN_IDS.size());
+    ASSERT_EQ(resumed_tokens, ref_tokens);
+}
+
+std::vector<int64_t> infer_swapped_beams_step(ov::InferRequest& infer_request,
+                                              const std::vector<int64_t>& tokens,
+                                              int64_t position) {
+    auto input_ids = ov::Tensor(ov::element::Type_t::i64, {2, 1});
+    std::copy(tokens.begin(), tokens.end(), input_ids.data<int64_t>());
+    infer_request.set_tensor("input_ids", input_ids);
+    auto position_ids = ov::Tensor(ov::element::Type_t::i64, {2, 1});
+    std::fill_n(position_ids.data<int64_t>(), 2, position);
+    infer_request.set_tensor("position_ids", position_ids);
+    auto beam_idx = ov::Tensor(ov::element::Type_t::i32, {2});
+    beam_idx.data<int32_t>()[0] = 1;
+    beam_idx.data<int32_t>()[1] = 0;
+    infer_request.set_tensor("beam_idx", beam_idx);
+    infer_request.infer();
+
+    ov::Tensor logits = infer_request.get_tensor("logits");
+    size_t vocab_size = logits.get_shape().back();
+    std::vector<int64_t> next_tokens;
+    for (size_t batch_idx = 0; batch_idx < 2; batch_idx++) {
+        const float* row = logits.data<float>() + (batch_idx + 1) * logits.get_size() / 2 - vocab_size;
+        next_tokens.push_back(std::max_element(row, row + vocab_size) - row);
+    }
+    return next_tokens;
+}
+
+TEST(LlamaCppStatePersistenceTest, RestoredBatchedStateAcceptsBeamIdx) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    auto infer_request = model.create_infer_request();
+
+    // the longer prompt is truncated so that both prompts form a rectangular batch
+    size_t prompt_length = GPT2_LENNON_PROMPT_TOKEN_IDS.size();
+    auto input_ids = ov::Tensor(ov::element::Type_t::i64, {2, prompt_length});
+    std::copy_n(GPT2_SUN_PROMPT_TOKEN_IDS.begin(), prompt_length, input_ids.data<int64_t>());
+    std::copy_n(GPT2_LENNON_PROMPT_TOKEN_IDS.begin(), prompt_length, input_ids.data<int64_t>() + prompt_length);
+    infer_request.set_tensor("input_ids", input_ids);
+    auto position_ids = ov::Tensor(ov::element::Type_t::i64, {2, prompt_length});
+    std::iota(position_ids.data<int64_t>(), position_ids.data<int64_t>() + prompt_length, 0);
+    std::iota(position_ids.data<int64_t>() + prompt_length, position_ids.data<int64_t>() + 2 * prompt_length, 0);
+    infer_request.set_tensor("position_ids", position_ids);
+    infer_request.infer();
+    ov::Tensor saved_state = infer_request.query_state()[0].get_state();
+
+    // the beam_idx values of the step after the restoring refer to the sequences of the saved batch, so the restored
+    // request must swap the histories of both sequences the same way as the original one
+    std::vector<int64_t> step_tokens = {GPT2_SUN_PROMPT_TOKEN_IDS.back(), GPT2_LENNON_PROMPT_TOKEN_IDS.back()};
+    std::vector<int64_t> ref_tokens = infer_swapped_beams_step(infer_request, step_tokens, prompt_length);
+
+    auto resumed_infer_request = model.create_infer_request();
+    resumed_infer_request.query_state()[0].set_state(saved_state);
+    std::vector<int64_t> resumed_tokens = infer_swapped_beams_step(resumed_infer_request, step_tokens, prompt_length);
+    ASSERT_EQ(resumed_tokens, ref_tokens);
+
+    // the generation goes on from the restored state as well
+    for (size_t i = 1; i < NUM_TOKENS_TO_GENERATE; i++) {
+        ref_tokens = infer_swapped_beams_step(infer_request, ref_tokens, prompt_length + i);
+        resumed_tokens = infer_swapped_beams_step(resumed_infer_request, resumed_tokens, prompt_length + i);
+        ASSERT_EQ(resumed_tokens, ref_tokens);
+    }
+}
+
+TEST(LlamaCppStatePersistenceTest, RejectsMalformedState) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP");
+    auto infer_request = model.create_infer_request();
+    ov::Tensor malformed_state(ov::element::u8, ov::Shape{4});
+    ASSERT_THROW(infer_request.query_state()[0].set_state(malformed_state), ov::Exception);
+}
+
+TEST(LlamaCppStatePersistenceTest, ThrowsWithContinuousBatching) {
+    ov::Core core;
+    auto model = core.compile_model(MODEL_FILE, "LLAMA_CPP", ov::llama_cpp::continuous_batching(true));
+    auto infer_request = model.create_infer_request();
+    ASSERT_THROW(infer_request.query_state()[0].get_state(), ov::Exception);
+}
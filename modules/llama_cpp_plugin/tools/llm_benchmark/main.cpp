@@ -0,0 +1,324 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+// Generation benchmark for the LLAMA_CPP plugin. Each of the concurrent workers owns an infer request and repeatedly
+// runs a prefill of a synthetic prompt followed by greedy decoding of a fixed number of tokens, recording the time to
+// first token (the prefill latency) and the time per each subsequently generated output token.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "llama_cpp/properties.hpp"
+#include "openvino/openvino.hpp"
+
+#ifdef _WIN32
+// clang-format off
+#    include <windows.h>
+#    include <psapi.h>
+// clang-format on
+#else
+#    include <sys/resource.h>
+#endif
+
+namespace {
+
+struct BenchmarkOptions {
+    std::string model_path;
+    std::string device = "LLAMA_CPP";
+    size_t prompt_length = 128;
+    size_t generation_length = 64;
+    size_t batch_size = 1;
+    size_t concurrency = 1;
+    size_t iterations = 3;
+    bool continuous_batching = false;
+};
+
+struct WorkerResults {
+    std::vector<double> ttft_ms;
+    std::vector<double> tpot_ms;
+    double prefill_time_s = 0.0;
+    double decode_time_s = 0.0;
+};
+
+void print_usage(const char* program_name) {
+    std::cout << "Usage: " << program_name << " -m <model.gguf> [options]\n"
+              << "Options:\n"
+              << "    -m, --model <path>           GGUF model file to benchmark\n"
+              << "    -d, --device <name>          OpenVINO device name (default: LLAMA_CPP)\n"
+              << "    -p, --prompt-length <n>      number of prompt tokens per sequence (default: 128)\n"
+              << "    -g, --generation-length <n>  number of generated tokens per sequence (default: 64)\n"
+              << "    -b, --batch-size <n>         number of sequences per infer request (default: 1)\n"
+              << "    -c, --concurrency <n>        number of concurrently running infer requests (default: 1)\n"
+              << "    -n, --iterations <n>         number of generations per infer request (default: 3)\n"
+              << "    --continuous-batching        share a single llama.cpp context among the infer requests\n"
+              << "    -h, --help                   print this message\n";
+}
+
+size_t parse_count(const std::string& option, const std::string& value) {
+    size_t pos = 0;
+    unsigned long long count = 0;
+    try {
+        count = std::stoull(value, &pos);
+    } catch (const std::exception&) {
+        pos = 0;
+    }
+    if (pos != value.size() || count == 0) {
+        throw std::invalid_argument("expected a positive integer value for " + option + ", got '" + value + "'");
+    }
+    return static_cast<size_t>(count);
+}
+
+BenchmarkOptions parse_options(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            print_usage(argv[0]);
+            std::exit(EXIT_SUCCESS);
+        }
+        if (arg == "--continuous-batching") {
+            options.continuous_batching = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw std::invalid_argument("missing value for " + arg);
+        }
+        std::string value = argv[++i];
+        if (arg == "-m" || arg == "--model") {
+            options.model_path = value;
+        } else if (arg == "-d" || arg == "--device") {
+            options.device = value;
+        } else if (arg == "-p" || arg == "--prompt-length") {
+            options.prompt_length = parse_count(arg, value);
+        } else if (arg == "-g" || arg == "--generation-length") {
+            options.generation_length = parse_count(arg, value);
+        } else if (arg == "-b" || arg == "--batch-size") {
+            options.batch_size = parse_count(arg, value);
+        } else if (arg == "-c" || arg == "--concurrency") {
+            options.concurrency = parse_count(arg, value);
+        } else if (arg == "-n" || arg == "--iterations") {
+            options.iterations = parse_count(arg, value);
+        } else {
+            throw std::invalid_argument("unknown option " + arg);
+        }
+    }
+    if (options.model_path.empty()) {
+        throw std::invalid_argument("the model file must be specified with -m");
+    }
+    return options;
+}
+
+size_t get_peak_rss_bytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return counters.PeakWorkingSetSize;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#    ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss);
+#    else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#    endif
+#endif
+}
+
+// Runs a single inference of `tokens` (`batch_size` rows of equal length) and returns the greedily selected next
+// token for each of the rows.
+std::vector<int64_t> infer_step(ov::InferRequest& infer_request,
+                                const std::vector<int64_t>& tokens,
+                                size_t batch_size,
+                                int64_t first_position) {
+    size_t sequence_length = tokens.size() / batch_size;
+    ov::Shape shape{batch_size, sequence_length};
+
+    ov::Tensor input_ids = infer_request.get_tensor("input_ids");
+    input_ids.set_shape(shape);
+    std::copy(tokens.begin(), tokens.end(), input_ids.data<int64_t>());
+
+    ov::Tensor position_ids = infer_request.get_tensor("position_ids");
+    position_ids.set_shape(shape);
+    for (size_t row = 0; row < batch_size; row++) {
+        int64_t* row_positions = position_ids.data<int64_t>() + row * sequence_length;
+        std::iota(row_positions, row_positions + sequence_length, first_position);
+    }
+
+    ov::Tensor attention_mask = infer_request.get_tensor("attention_mask");
+    attention_mask.set_shape({batch_size, static_cast<size_t>(first_position) + sequence_length});
+    std::fill_n(attention_mask.data<int64_t>(), attention_mask.get_size(), 1);
+
+    ov::Tensor beam_idx = infer_request.get_tensor("beam_idx");
+    beam_idx.set_shape({batch_size});
+    std::iota(beam_idx.data<int32_t>(), beam_idx.data<int32_t>() + batch_size, 0);
+
+    infer_request.infer();
+
+    ov::Tensor logits = infer_request.get_tensor("logits");
+    size_t n_rows_per_sequence = logits.get_shape()[1];
+    size_t vocab_size = logits.get_shape()[2];
+    std::vector<int64_t> next_tokens(batch_size);
+    for (size_t row = 0; row < batch_size; row++) {
+        const float* last_logits = logits.data<float>() + ((row + 1) * n_rows_per_sequence - 1) * vocab_size;
+        next_tokens[row] = std::max_element(last_logits, last_logits + vocab_size) - last_logits;
+    }
+    return next_tokens;
+}
+
+void run_worker(ov::CompiledModel& compiled_model,
+                const BenchmarkOptions& options,
+                size_t worker_idx,
+                WorkerResults& results) {
+    ov::InferRequest infer_request = compiled_model.create_infer_request();
+
+    // synthetic prompts; the token values are taken from a range present in any practically used vocabulary
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(worker_idx));
+    std::uniform_int_distribution<int64_t> token_distribution(100, 999);
+    std::vector<int64_t> prompt(options.batch_size * options.prompt_length);
+
+    for (size_t iteration = 0; iteration < options.iterations; iteration++) {
+        for (auto&& state : infer_request.query_state()) {
+            state.reset();
+        }
+        std::generate(prompt.begin(), prompt.end(), [&]() {
+            return token_distribution(generator);
+        });
+
+        auto prefill_start = std::chrono::steady_clock::now();
+        std::vector<int64_t> next_tokens = infer_step(infer_request, prompt, options.batch_size, 0);
+        auto prefill_end = std::chrono::steady_clock::now();
+
+        double prefill_time_s = std::chrono::duration<double>(prefill_end - prefill_start).count();
+        results.ttft_ms.push_back(prefill_time_s * 1e3);
+        results.prefill_time_s += prefill_time_s;
+
+        int64_t position = static_cast<int64_t>(options.prompt_length);
+        for (size_t token_idx = 1; token_idx < options.generation_length; token_idx++) {
+            auto step_start = std::chrono::steady_clock::now();
+            next_tokens = infer_step(infer_request, next_tokens, options.batch_size, position);
+            auto step_end = std::chrono::steady_clock::now();
+
+            double step_time_s = std::chrono::duration<double>(step_end - step_start).count();
+            results.tpot_ms.push_back(step_time_s * 1e3);
+            results.decode_time_s += step_time_s;
+            position++;
+        }
+    }
+}
+
+double get_percentile(std::vector<double> values, double percentile) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t idx = static_cast<size_t>(percentile / 100.0 * (values.size() - 1) + 0.5);
+    return values[std::min(idx, values.size() - 1)];
+}
+
+void print_latency_stats(const std::string& name, const std::vector<double>& values_ms) {
+    std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(2)
+              << "p50 " << std::setw(10) << get_percentile(values_ms, 50) << "  p90 " << std::setw(10)
+              << get_percentile(values_ms, 90) << "  p99 " << std::setw(10) << get_percentile(values_ms, 99) << '\n';
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& ex) {
+        std::cerr << "Error: " << ex.what() << "\n\n";
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        ov::Core core;
+        ov::AnyMap properties{ov::llama_cpp::logits_last_token_only(true),
+                              ov::llama_cpp::continuous_batching(options.continuous_batching)};
+
+        auto load_start = std::chrono::steady_clock::now();
+        ov::CompiledModel compiled_model = core.compile_model(options.model_path, options.device, properties);
+        auto load_end = std::chrono::steady_clock::now();
+
+        std::vector<WorkerResults> results(options.concurrency);
+        std::vector<std::exception_ptr> errors(options.concurrency);
+        std::vector<std::thread> workers;
+
+        auto run_start = std::chrono::steady_clock::now();
+        for (size_t worker_idx = 0; worker_idx < options.concurrency; worker_idx++) {
+            workers.emplace_back([&, worker_idx]() {
+                try {
+                    run_worker(compiled_model, options, worker_idx, results[worker_idx]);
+                } catch (...) {
+                    errors[worker_idx] = std::current_exception();
+                }
+            });
+        }
+        for (auto&& worker : workers) {
+            worker.join();
+        }
+        auto run_end = std::chrono::steady_clock::now();
+
+        for (auto&& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        WorkerResults total;
+        for (auto&& worker_results : results) {
+            total.ttft_ms.insert(total.ttft_ms.end(), worker_results.ttft_ms.begin(), worker_results.ttft_ms.end());
+            total.tpot_ms.insert(total.tpot_ms.end(), worker_results.tpot_ms.begin(), worker_results.tpot_ms.end());
+            total.prefill_time_s += worker_results.prefill_time_s;
+            total.decode_time_s += worker_results.decode_time_s;
+        }
+
+        size_t n_sequences = options.concurrency * options.iterations * options.batch_size;
+        size_t n_prompt_tokens = n_sequences * options.prompt_length;
+        size_t n_generated_tokens = n_sequences * options.generation_length;
+        double run_time_s = std::chrono::duration<double>(run_end - run_start).count();
+
+        std::cout << "Model:                      " << options.model_path << '\n'
+                  << "Device:                     " << options.device << '\n'
+                  << "Prompt / generation length: " << options.prompt_length << " / " << options.generation_length
+                  << '\n'
+                  << "Batch size x concurrency:   " << options.batch_size << " x " << options.concurrency << '\n'
+                  << "Iterations per request:     " << options.iterations << '\n'
+                  << std::fixed << std::setprecision(2) << "Model load time, ms:        "
+                  << std::chrono::duration<double, std::milli>(load_end - load_start).count() << "\n\n";
+
+        print_latency_stats("Time to first token, ms:", total.ttft_ms);
+        print_latency_stats("Time per output token, ms:", total.tpot_ms);
+
+        // the per-stage throughputs are normalized by the time summed over the workers, i.e. show the throughput of
+        // a single infer request, while the overall throughput is measured against the wall-clock time of the run
+        std::cout << '\n'
+                  << "Prefill throughput, tok/s:  "
+                  << (total.prefill_time_s > 0 ? n_prompt_tokens / total.prefill_time_s : 0.0) << '\n'
+                  << "Decode throughput, tok/s:   "
+                  << (total.decode_time_s > 0 ? (n_generated_tokens - n_sequences) / total.decode_time_s : 0.0) << '\n'
+                  << "Overall throughput, tok/s:  " << (n_prompt_tokens + n_generated_tokens) / run_time_s << '\n'
+                  << "Generated tokens/s:         " << n_generated_tokens / run_time_s << '\n'
+                  << "Peak RSS, MiB:              " << get_peak_rss_bytes() / (1024.0 * 1024.0) << '\n';
+    } catch (const std::exception& ex) {
+        std::cerr << "Error: " << ex.what() << '\n';
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}